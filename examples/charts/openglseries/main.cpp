@@ -35,7 +35,12 @@
 #include <QtCharts/QScatterSeries>
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QLogValueAxis>
+#include <QtCharts/QDateTimeAxis>
+#include <QtCharts/QXYDataSource>
 #include <QtWidgets/QLabel>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QFileInfo>
+#include <QtCore/QDebug>
 
 // Uncomment to use logarithmic axes instead of regular value axes
 //#define USE_LOG_AXIS
@@ -49,9 +54,110 @@
 
 QT_CHARTS_USE_NAMESPACE
 
+static QXYFileDataSource::ValueType valueType(const QString &name)
+{
+    if (name == QLatin1String("float32"))
+        return QXYFileDataSource::Float32;
+    if (name == QLatin1String("float64"))
+        return QXYFileDataSource::Float64;
+    return QXYFileDataSource::Int64;
+}
+
+static int valueSize(QXYFileDataSource::ValueType type)
+{
+    return type == QXYFileDataSource::Float32 ? 4 : 8;
+}
+
+// Creates a chart of a binary file of timestamps and values, which can hold far more
+// points than fit in memory as a list of points.
+static QChart *createFileChart(const QString &fileName, QXYFileDataSource::ValueType xType,
+                               QXYFileDataSource::ValueType yType, qint64 headerSize,
+                               bool interleaved)
+{
+    QChart *chart = new QChart();
+    chart->legend()->hide();
+    chart->setTitle(QFileInfo(fileName).fileName());
+
+    //![2]
+    QLineSeries *series = new QLineSeries;
+    QXYFileDataSource *source = new QXYFileDataSource(series);
+    source->setFileName(fileName);
+    const int xSize = valueSize(xType);
+    const int ySize = valueSize(yType);
+    if (interleaved) {
+        source->setXColumn(xType, headerSize, xSize + ySize);
+        source->setYColumn(yType, headerSize + xSize, xSize + ySize);
+    } else {
+        const qint64 count = (QFileInfo(fileName).size() - headerSize) / (xSize + ySize);
+        source->setXColumn(xType, headerSize);
+        source->setYColumn(yType, headerSize + count * xSize);
+    }
+    if (!source->open())
+        qWarning() << "Cannot read" << fileName << source->errorString();
+
+    series->setDataSource(source);
+    series->setDecimationMode(QLineSeries::MinMaxDecimation);
+    //![2]
+    chart->addSeries(series);
+
+    QAbstractAxis *axisX;
+    if (xType == QXYFileDataSource::Int64) {
+        QDateTimeAxis *dateTimeAxis = new QDateTimeAxis;
+        dateTimeAxis->setFormat(QStringLiteral("dd.MM. hh:mm:ss"));
+        axisX = dateTimeAxis;
+    } else {
+        axisX = new QValueAxis;
+    }
+    QValueAxis *axisY = new QValueAxis;
+    chart->addAxis(axisX, Qt::AlignBottom);
+    chart->addAxis(axisY, Qt::AlignLeft);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+
+    return chart;
+}
+
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral(
+            "Shows generated data, or a binary file of timestamps and values."));
+    parser.addHelpOption();
+    parser.addPositionalArgument(QStringLiteral("file"), QStringLiteral(
+            "Binary file with a column of timestamps followed by a column of values."));
+    QCommandLineOption xTypeOption(QStringLiteral("x-type"), QStringLiteral(
+            "Type of the timestamps: float32, float64 or int64 milliseconds since the epoch."),
+            QStringLiteral("type"), QStringLiteral("int64"));
+    QCommandLineOption yTypeOption(QStringLiteral("y-type"), QStringLiteral(
+            "Type of the values: float32, float64 or int64."),
+            QStringLiteral("type"), QStringLiteral("float32"));
+    QCommandLineOption headerOption(QStringLiteral("header"), QStringLiteral(
+            "Size of the header preceding the data in bytes."),
+            QStringLiteral("bytes"), QStringLiteral("0"));
+    QCommandLineOption interleavedOption(QStringLiteral("interleaved"), QStringLiteral(
+            "The timestamps and the values are stored as interleaved pairs."));
+    parser.addOption(xTypeOption);
+    parser.addOption(yTypeOption);
+    parser.addOption(headerOption);
+    parser.addOption(interleavedOption);
+    parser.process(a);
+
+    if (!parser.positionalArguments().isEmpty()) {
+        // The file is drawn without OpenGL, as the decimated series has only a few points
+        // per pixel. Select a range with the mouse to zoom in, right-click to zoom out.
+        QChartView fileView(createFileChart(parser.positionalArguments().first(),
+                                            valueType(parser.value(xTypeOption)),
+                                            valueType(parser.value(yTypeOption)),
+                                            parser.value(headerOption).toLongLong(),
+                                            parser.isSet(interleavedOption)));
+        fileView.setRubberBand(QChartView::HorizontalRubberBand);
+        fileView.resize(800, 400);
+        fileView.show();
+        return a.exec();
+    }
+
     QStringList colors;
     colors << "red" << "blue" << "green" << "black";
 
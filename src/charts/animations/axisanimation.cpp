@@ -30,6 +30,7 @@
 #include <private/axisanimation_p.h>
 #include <private/chartaxiselement_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/chartpresenter_p.h>
 
 Q_DECLARE_METATYPE(QVector<qreal>)
 
@@ -136,6 +137,7 @@ QVariant AxisAnimation::interpolated(const QVariant &start, const QVariant &end,
 void AxisAnimation::updateCurrentValue(const QVariant &value)
 {
     if (state() != QAbstractAnimation::Stopped) { //workaround
+        ChartTimingScope timing(m_axis->presenter(), QChart::AxisTiming);
         QVector<qreal> vector = qvariant_cast<QVector<qreal> >(value);
         m_axis->setLayout(vector);
         m_axis->updateGeometry();
@@ -46,6 +46,7 @@
 QT_CHARTS_BEGIN_NAMESPACE
 
 const static int ChartAnimationDuration = 1000;
+const static int ChartAnimationPointLimit = 10000;
 
 class Q_CHARTS_PRIVATE_EXPORT ChartAnimation: public QVariantAnimation
 {
@@ -31,9 +31,6 @@
 #include <private/splinechartitem_p.h>
 #include <QtCore/QDebug>
 
-Q_DECLARE_METATYPE(QVector<QPointF>)
-Q_DECLARE_METATYPE(SplineVector)
-
 QT_CHARTS_BEGIN_NAMESPACE
 
 SplineAnimation::SplineAnimation(SplineChartItem *item, int duration, QEasingCurve &curve)
@@ -119,8 +116,10 @@ void SplineAnimation::setup(QVector<QPointF> &oldPoints, QVector<QPointF> &newPo
     }
 
 
-    setKeyValueAt(0.0, QVariant::fromValue(m_oldSpline));
-    setKeyValueAt(1.0, QVariant::fromValue(m_newSpline));
+    setKeyValueAt(0.0, qreal(0));
+    setKeyValueAt(1.0, qreal(1));
+    m_currentPoints.reserve(qMax(m_oldSpline.first.count(), m_newSpline.first.count()));
+    m_currentControlPoints.reserve(qMax(m_oldSpline.second.count(), m_newSpline.second.count()));
 
     m_valid = true;
 
@@ -128,60 +127,47 @@ void SplineAnimation::setup(QVector<QPointF> &oldPoints, QVector<QPointF> &newPo
 
 QVariant SplineAnimation::interpolated(const QVariant &start, const QVariant &end, qreal progress) const
 {
-
-    SplineVector startPair = qvariant_cast< SplineVector >(start);
-    SplineVector endPair = qvariant_cast< SplineVector >(end);
-    SplineVector result;
-
-    switch (animationType()) {
-    case RemovePointAnimation:
-    case AddPointAnimation:
-    case ReplacePointAnimation: {
-        if (startPair.first.count() != endPair.first.count())
-            break;
-        Q_ASSERT(startPair.first.count() * 2 - 2 == startPair.second.count());
-        Q_ASSERT(endPair.first.count() * 2 - 2 == endPair.second.count());
-        for (int i = 0; i < endPair.first.count(); i++) {
-            qreal x = startPair.first[i].x() + ((endPair.first[i].x() - startPair.first[i].x()) * progress);
-            qreal y = startPair.first[i].y() + ((endPair.first[i].y() - startPair.first[i].y()) * progress);
-            result.first << QPointF(x, y);
-            if (i + 1 >= endPair.first.count())
-                continue;
-            x = startPair.second[i * 2].x() + ((endPair.second[i * 2].x() - startPair.second[i * 2].x()) * progress);
-            y = startPair.second[i * 2].y() + ((endPair.second[i * 2].y() - startPair.second[i * 2].y()) * progress);
-            result.second << QPointF(x, y);
-            x = startPair.second[i * 2 + 1].x() + ((endPair.second[i * 2 + 1].x() - startPair.second[i * 2 + 1].x()) * progress);
-            y = startPair.second[i * 2 + 1].y() + ((endPair.second[i * 2 + 1].y() - startPair.second[i * 2 + 1].y()) * progress);
-            result.second << QPointF(x, y);
-        }
-    }
-    break;
-    case NewAnimation: {
-        Q_ASSERT(endPair.first.count() * 2 - 2 == endPair.second.count());
-        int count = endPair.first.count() * qBound(qreal(0), progress, qreal(1));
-        for (int i = 0; i < count; i++) {
-            result.first << endPair.first[i];
-            if (i + 1 == count)
-                break;
-            result.second << endPair.second[2 * i];
-            result.second << endPair.second[2 * i + 1];
-        }
-    }
-    break;
-    default:
-        qWarning() << "Unknown type of animation";
-        break;
-    }
-
-    return QVariant::fromValue(result);
+    Q_UNUSED(start);
+    Q_UNUSED(end);
+    return progress;
 }
 
 void SplineAnimation::updateCurrentValue(const QVariant &value)
 {
     if (state() != QAbstractAnimation::Stopped && m_valid) { //workaround
-        QPair<QVector<QPointF >, QVector<QPointF > > pair = qvariant_cast< QPair< QVector<QPointF>, QVector<QPointF> > >(value);
-        m_item->setGeometryPoints(pair.first);
-        m_item->setControlGeometryPoints(pair.second);
+        const qreal progress = value.toReal();
+
+        switch (animationType()) {
+        case RemovePointAnimation:
+        case AddPointAnimation:
+        case ReplacePointAnimation:
+            if (m_oldSpline.first.count() != m_newSpline.first.count()) {
+                m_currentPoints.resize(0);
+                m_currentControlPoints.resize(0);
+                break;
+            }
+            Q_ASSERT(m_oldSpline.first.count() * 2 - 2 == m_oldSpline.second.count());
+            Q_ASSERT(m_newSpline.first.count() * 2 - 2 == m_newSpline.second.count());
+            interpolatePoints(m_oldSpline.first, m_newSpline.first, progress, m_currentPoints);
+            interpolatePoints(m_oldSpline.second, m_newSpline.second, progress,
+                              m_currentControlPoints);
+            break;
+        case NewAnimation: {
+            Q_ASSERT(m_newSpline.first.count() * 2 - 2 == m_newSpline.second.count());
+            const int count = m_newSpline.first.count() * qBound(qreal(0), progress, qreal(1));
+            copyPoints(m_newSpline.first, count, m_currentPoints);
+            copyPoints(m_newSpline.second, qMax(0, 2 * count - 2), m_currentControlPoints);
+        }
+        break;
+        default:
+            qWarning() << "Unknown type of animation";
+            m_currentPoints.resize(0);
+            m_currentControlPoints.resize(0);
+            break;
+        }
+
+        m_item->swapGeometryPoints(m_currentPoints);
+        m_item->swapControlGeometryPoints(m_currentControlPoints);
         m_item->updateGeometry();
         m_item->setDirty(true);
         m_dirty = false;
@@ -64,6 +64,9 @@ protected:
 private:
     SplineVector m_oldSpline;
     SplineVector m_newSpline;
+    // Receive the interpolated points of each frame, see XYAnimation::updateCurrentValue()
+    QVector<QPointF> m_currentPoints;
+    QVector<QPointF> m_currentControlPoints;
     SplineChartItem *m_item;
     bool m_valid;
 };
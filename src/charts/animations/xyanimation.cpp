@@ -30,8 +30,8 @@
 #include <private/xyanimation_p.h>
 #include <private/xychart_p.h>
 #include <QtCore/QDebug>
-
-Q_DECLARE_METATYPE(QVector<QPointF>)
+#include <QtCore/QtMath>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -97,56 +97,76 @@ void XYAnimation::setup(const QVector<QPointF> &oldPoints, const QVector<QPointF
     else if (m_type == NewAnimation)
         m_type = ReplacePointAnimation;
 
-    setKeyValueAt(0.0, QVariant::fromValue(m_oldPoints));
-    setKeyValueAt(1.0, QVariant::fromValue(m_newPoints));
+    // The animated value is just the eased progress, the points are interpolated into
+    // m_currentPoints in updateCurrentValue().
+    setKeyValueAt(0.0, qreal(0));
+    setKeyValueAt(1.0, qreal(1));
+    m_currentPoints.reserve(qMax(m_oldPoints.count(), m_newPoints.count()));
 }
 
 QVariant XYAnimation::interpolated(const QVariant &start, const QVariant &end, qreal progress) const
 {
-    QVector<QPointF> startVector = qvariant_cast<QVector<QPointF> >(start);
-    QVector<QPointF> endVector = qvariant_cast<QVector<QPointF> >(end);
-    QVector<QPointF> result;
-
-    switch (m_type) {
-
-    case ReplacePointAnimation:
-    case AddPointAnimation:
-    case RemovePointAnimation: {
-        if (startVector.count() != endVector.count())
-            break;
-
-        for (int i = 0; i < startVector.count(); i++) {
-            qreal x = startVector[i].x() + ((endVector[i].x() - startVector[i].x()) * progress);
-            qreal y = startVector[i].y() + ((endVector[i].y() - startVector[i].y()) * progress);
-            result << QPointF(x, y);
-        }
-
-    }
-    break;
-    case NewAnimation: {
-        for (int i = 0; i < endVector.count() * qBound(qreal(0), progress, qreal(1)); i++)
-            result << endVector[i];
-    }
-    break;
-    default:
-        qWarning() << "Unknown type of animation";
-        break;
-    }
-
-    return QVariant::fromValue(result);
+    Q_UNUSED(start);
+    Q_UNUSED(end);
+    return progress;
 }
 
 void XYAnimation::updateCurrentValue(const QVariant &value)
 {
     if (state() != QAbstractAnimation::Stopped) { //workaround
+        const qreal progress = value.toReal();
 
-        QVector<QPointF> vector = qvariant_cast<QVector<QPointF> >(value);
-        m_item->setGeometryPoints(vector);
+        switch (m_type) {
+        case ReplacePointAnimation:
+        case AddPointAnimation:
+        case RemovePointAnimation:
+            interpolatePoints(m_oldPoints, m_newPoints, progress, m_currentPoints);
+            break;
+        case NewAnimation: {
+            const qreal visible = m_newPoints.count() * qBound(qreal(0), progress, qreal(1));
+            copyPoints(m_newPoints, qCeil(visible), m_currentPoints);
+        }
+        break;
+        default:
+            qWarning() << "Unknown type of animation";
+            m_currentPoints.resize(0);
+            break;
+        }
+
+        // The item takes the points of this frame and hands back those of the previous frame.
+        // Once the item has updated its geometry, nothing else refers to them, so the next
+        // frame is interpolated into the same buffer without allocating.
+        m_item->swapGeometryPoints(m_currentPoints);
         m_item->updateGeometry();
         m_item->setDirty(true);
         m_dirty = false;
+    }
+}
 
+// Writes the points interpolated between start and end at progress to result. The result is
+// resized within its capacity, so the same buffer can be used for every frame.
+void XYAnimation::interpolatePoints(const QVector<QPointF> &start, const QVector<QPointF> &end,
+                                    qreal progress, QVector<QPointF> &result)
+{
+    if (start.count() != end.count()) {
+        result.resize(0);
+        return;
     }
+
+    result.resize(end.count());
+    const QPointF *startData = start.constData();
+    const QPointF *endData = end.constData();
+    QPointF *resultData = result.data();
+    for (int i = 0; i < end.count(); i++)
+        resultData[i] = startData[i] + (endData[i] - startData[i]) * progress;
+}
+
+// Writes the first count points to result, reusing its buffer like interpolatePoints()
+void XYAnimation::copyPoints(const QVector<QPointF> &points, int count, QVector<QPointF> &result)
+{
+    count = qBound(0, count, int(points.count()));
+    result.resize(count);
+    std::copy(points.constBegin(), points.constBegin() + count, result.begin());
 }
 
 void XYAnimation::updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState)
@@ -62,6 +62,10 @@ protected:
     void updateCurrentValue(const QVariant &value);
     void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState);
     XYChart *chartItem() { return m_item; }
+
+    static void interpolatePoints(const QVector<QPointF> &start, const QVector<QPointF> &end,
+                                  qreal progress, QVector<QPointF> &result);
+    static void copyPoints(const QVector<QPointF> &points, int count, QVector<QPointF> &result);
 protected:
     Animation m_type;
     bool m_dirty;
@@ -70,6 +74,8 @@ private:
     XYChart *m_item;
     QVector<QPointF> m_oldPoints;
     QVector<QPointF> m_newPoints;
+    // Receives the interpolated points of each frame, see updateCurrentValue()
+    QVector<QPointF> m_currentPoints;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -142,6 +142,7 @@ QPainterPath AreaChartItem::shape() const
 
 void AreaChartItem::updatePath()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     QPainterPath path;
     QRectF rect(QPointF(0,0),domain()->size());
 
@@ -141,6 +141,28 @@ public:
         }
     }
 
+    void updateGeometryAppended(int index, int count)
+    {
+        // The area path is built from both bounds, so it cannot be extended segment by segment.
+        Q_UNUSED(index);
+        Q_UNUSED(count);
+        updateGeometry();
+    }
+
+    void updateGeometryShifted(int removed, int count)
+    {
+        Q_UNUSED(removed);
+        Q_UNUSED(count);
+        updateGeometry();
+    }
+
+    bool cullingEnabled() const
+    {
+        // The point labels of the area series are drawn from the geometry points of the bounds,
+        // so the bounds need to map one-to-one to the series points.
+        return false;
+    }
+
 private:
     AreaChartItem *m_item;
 };
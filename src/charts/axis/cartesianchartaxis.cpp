@@ -37,6 +37,7 @@
 #include <private/abstractdomain_p.h>
 #include <private/cartesianchartaxis_p.h>
 #include <private/chartpresenter_p.h>
+#include <private/charttextitem_p.h>
 #include <private/linearrowitem_p.h>
 #include <private/qabstractaxis_p.h>
 
@@ -81,7 +82,7 @@ void CartesianChartAxis::createItems(int count)
     for (int i = 0; i < count; ++i) {
         QGraphicsLineItem *arrow = new QGraphicsLineItem(this);
         QGraphicsLineItem *grid = new QGraphicsLineItem(this);
-        QGraphicsTextItem *label;
+        ChartTextItem *label;
         if (axis()->type() == QtCharts::QAbstractAxis::AxisTypeValue) {
             label = new ValueAxisLabel(this);
             connect(static_cast<ValueAxisLabel *>(label), &ValueAxisLabel::valueChanged,
@@ -97,10 +98,9 @@ void CartesianChartAxis::createItems(int count)
                 dateTimeLabel->setEditable(true);
             dateTimeLabel->setFormat(static_cast<QDateTimeAxis*>(axis())->format());
         } else {
-            label = new QGraphicsTextItem(this);
+            label = new ChartTextItem(this);
         }
 
-        label->document()->setDocumentMargin(ChartPresenter::textMargin());
         arrow->setPen(axis()->linePen());
         grid->setPen(axis()->gridLinePen());
         label->setFont(axis()->labelsFont());
@@ -222,6 +222,7 @@ void CartesianChartAxis::deleteItems(int count)
 
 void CartesianChartAxis::updateLayout(QVector<qreal> &layout)
 {
+    ChartTimingScope timing(presenter(), QChart::AxisTiming);
     int diff = ChartAxisElement::layout().size() - layout.size();
 
     if (diff > 0)
@@ -35,7 +35,7 @@
 QT_CHARTS_BEGIN_NAMESPACE
 
 EditableAxisLabel::EditableAxisLabel(QGraphicsItem *parent) :
-    QGraphicsTextItem(parent)
+    ChartTextItem(parent)
 {
 
 }
@@ -81,6 +81,9 @@ bool EditableAxisLabel::sceneEvent(QEvent *event)
 void EditableAxisLabel::setEditable(bool editable)
 {
     m_editable = editable;
+    // Editing works on the text document
+    if (m_editable && isStaticText())
+        applyText();
 }
 
 void EditableAxisLabel::reloadBeforeEditContent()
@@ -91,7 +94,7 @@ void EditableAxisLabel::reloadBeforeEditContent()
 
 QRectF EditableAxisLabel::boundingRect() const
 {
-    QRectF ret = QGraphicsTextItem::boundingRect();
+    QRectF ret = ChartTextItem::boundingRect();
 
     // add 2px margin to allow the cursor to
     // show up properly when editing
@@ -100,6 +103,11 @@ QRectF EditableAxisLabel::boundingRect() const
     return ret;
 }
 
+bool EditableAxisLabel::canUseStaticText() const
+{
+    return !m_editable;
+}
+
 bool EditableAxisLabel::isEditEndingKeyPress(QKeyEvent *event)
 {
     if (event->text().length() >= 1) {
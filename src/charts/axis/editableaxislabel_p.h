@@ -40,6 +40,7 @@
 #define EDITABLEAXISLABEL_P_H
 
 #include <QtCharts/private/qchartglobal_p.h>
+#include <private/charttextitem_p.h>
 
 #include <QtWidgets/qgraphicsitem.h>
 #include <QtGui/qevent.h>
@@ -47,7 +48,7 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class Q_CHARTS_PRIVATE_EXPORT EditableAxisLabel : public QGraphicsTextItem
+class Q_CHARTS_PRIVATE_EXPORT EditableAxisLabel : public ChartTextItem
 {
     Q_OBJECT
 public:
@@ -66,6 +67,8 @@ protected:
     bool m_editing = false;
     bool m_editable = false;
 
+    bool canUseStaticText() const;
+
     virtual void setInitialEditValue() = 0;
     virtual void finishEditing() = 0;
     virtual void resetBeforeEditValue() = 0;
@@ -31,6 +31,7 @@
 #include <QtCharts/qlogvalueaxis.h>
 #include <QtCore/qmath.h>
 #include <private/chartpresenter_p.h>
+#include <private/charttextitem_p.h>
 #include <private/horizontalaxis_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -137,7 +138,7 @@ void HorizontalAxis::updateGeometry()
         //items
         QGraphicsLineItem *gridItem = static_cast<QGraphicsLineItem*>(lines.at(i));
         QGraphicsLineItem *tickItem = static_cast<QGraphicsLineItem*>(arrow.at(i + 1));
-        QGraphicsTextItem *labelItem = static_cast<QGraphicsTextItem *>(labels.at(i));
+        ChartTextItem *labelItem = static_cast<ChartTextItem *>(labels.at(i));
 
         //grid line
         if (axis()->isReverse()) {
@@ -154,19 +155,21 @@ void HorizontalAxis::updateGeometry()
         else
             text = labelList.at(i);
 
+        labelItem->setStaticTextEnabled(presenter()->plainTextLabels());
+
         QRectF boundingRect;
         // don't truncate empty labels
         if (text.isEmpty()) {
-            labelItem->setHtml(text);
+            labelItem->setText(text);
         } else  {
             qreal labelWidth = axisRect.width() / layout.count() - (2 * labelPadding());
             QString truncatedText = ChartPresenter::truncatedText(axis()->labelsFont(), text,
                                                                   axis()->labelsAngle(),
                                                                   labelWidth,
                                                                   availableSpace, boundingRect);
-            labelItem->setTextWidth(ChartPresenter::textBoundingRect(axis()->labelsFont(),
-                                                                     truncatedText).width());
-            labelItem->setHtml(truncatedText);
+            labelItem->setText(truncatedText,
+                               ChartPresenter::textBoundingRect(axis()->labelsFont(),
+                                                                truncatedText).width());
         }
 
         //label transformation origin point
@@ -255,7 +258,7 @@ void HorizontalAxis::updateGeometry()
         labelItem->setPos(labelPos.toPoint());
 
         //label overlap detection - compensate one pixel for rounding errors
-        if ((labelItem->pos().x() < width && labelItem->toPlainText() == ellipsis) || forceHide ||
+        if ((labelItem->pos().x() < width && labelItem->text() == ellipsis) || forceHide ||
             (labelItem->pos().x() + (widthDiff / 2.0)) < (axisRect.left() - 1.0) ||
             (labelItem->pos().x() + (widthDiff / 2.0) - 1.0) > axisRect.right()) {
             labelItem->setVisible(false);
@@ -65,6 +65,7 @@ QRectF PolarChartAxis::gridGeometry() const
 
 void PolarChartAxis::updateLayout(QVector<qreal> &layout)
 {
+    ChartTimingScope timing(presenter(), QChart::AxisTiming);
     int diff = ChartAxisElement::layout().size() - layout.size();
 
     if (animation()) {
@@ -32,6 +32,7 @@
 #include <QtCore/qmath.h>
 #include <QtGui/qtextdocument.h>
 #include <private/chartpresenter_p.h>
+#include <private/charttextitem_p.h>
 #include <private/polarchartaxisangular_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -85,7 +86,7 @@ void PolarChartAxisAngular::updateGeometry()
 
         QGraphicsLineItem *gridLineItem = static_cast<QGraphicsLineItem *>(gridItemList.at(i));
         QGraphicsLineItem *tickItem = static_cast<QGraphicsLineItem *>(arrowItemList.at(i + 1));
-        QGraphicsTextItem *labelItem = static_cast<QGraphicsTextItem *>(labelItemList.at(i));
+        ChartTextItem *labelItem = static_cast<ChartTextItem *>(labelItemList.at(i));
         QGraphicsPathItem *shadeItem = 0;
         if (i == 0)
             shadeItem = static_cast<QGraphicsPathItem *>(shadeItemList.at(0));
@@ -144,8 +145,8 @@ void PolarChartAxisAngular::updateGeometry()
             QRectF boundingRect = ChartPresenter::textBoundingRect(axis()->labelsFont(),
                                                                    labelList.at(i),
                                                                    axis()->labelsAngle());
-            labelItem->setTextWidth(boundingRect.width());
-            labelItem->setHtml(labelList.at(i));
+            labelItem->setStaticTextEnabled(presenter()->plainTextLabels());
+            labelItem->setText(labelList.at(i), boundingRect.width());
             const QRectF &rect = labelItem->boundingRect();
             QPointF labelCenter = rect.center();
             labelItem->setTransformOriginPoint(labelCenter.x(), labelCenter.y());
@@ -285,8 +286,7 @@ void PolarChartAxisAngular::createItems(int count)
     for (int i = 0; i < count; ++i) {
         QGraphicsLineItem *arrow = new QGraphicsLineItem(presenter()->rootItem());
         QGraphicsLineItem *grid = new QGraphicsLineItem(presenter()->rootItem());
-        QGraphicsTextItem *label = new QGraphicsTextItem(presenter()->rootItem());
-        label->document()->setDocumentMargin(ChartPresenter::textMargin());
+        ChartTextItem *label = new ChartTextItem(presenter()->rootItem());
         arrow->setPen(axis()->linePen());
         grid->setPen(axis()->gridLinePen());
         label->setFont(axis()->labelsFont());
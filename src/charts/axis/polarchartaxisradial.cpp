@@ -32,6 +32,7 @@
 #include <QtCore/qmath.h>
 #include <QtGui/qtextdocument.h>
 #include <private/chartpresenter_p.h>
+#include <private/charttextitem_p.h>
 #include <private/linearrowitem_p.h>
 #include <private/polarchartaxisradial_p.h>
 
@@ -80,7 +81,7 @@ void PolarChartAxisRadial::updateGeometry()
 
         QGraphicsEllipseItem *gridItem = static_cast<QGraphicsEllipseItem *>(gridItemList.at(i));
         QGraphicsLineItem *tickItem = static_cast<QGraphicsLineItem *>(arrowItemList.at(i + 1));
-        QGraphicsTextItem *labelItem = static_cast<QGraphicsTextItem *>(labelItemList.at(i));
+        ChartTextItem *labelItem = static_cast<ChartTextItem *>(labelItemList.at(i));
         QGraphicsPathItem *shadeItem = 0;
         if (i == 0)
             shadeItem = static_cast<QGraphicsPathItem *>(shadeItemList.at(0));
@@ -134,8 +135,8 @@ void PolarChartAxisRadial::updateGeometry()
             QRectF boundingRect = ChartPresenter::textBoundingRect(axis()->labelsFont(),
                                                                    labelList.at(i),
                                                                    axis()->labelsAngle());
-            labelItem->setTextWidth(boundingRect.width());
-            labelItem->setHtml(labelList.at(i));
+            labelItem->setStaticTextEnabled(presenter()->plainTextLabels());
+            labelItem->setText(labelList.at(i), boundingRect.width());
             QRectF labelRect = labelItem->boundingRect();
             QPointF labelCenter = labelRect.center();
             labelItem->setTransformOriginPoint(labelCenter.x(), labelCenter.y());
@@ -272,8 +273,7 @@ void PolarChartAxisRadial::createItems(int count)
     for (int i = 0; i < count; ++i) {
         QGraphicsLineItem *arrow = new QGraphicsLineItem(presenter()->rootItem());
         QGraphicsEllipseItem *grid = new QGraphicsEllipseItem(presenter()->rootItem());
-        QGraphicsTextItem *label = new QGraphicsTextItem(presenter()->rootItem());
-        label->document()->setDocumentMargin(ChartPresenter::textMargin());
+        ChartTextItem *label = new ChartTextItem(presenter()->rootItem());
         arrow->setPen(axis()->linePen());
         grid->setPen(axis()->gridLinePen());
         label->setFont(axis()->labelsFont());
@@ -31,6 +31,7 @@
 #include <QtCharts/qlogvalueaxis.h>
 #include <QtCore/qmath.h>
 #include <private/chartpresenter_p.h>
+#include <private/charttextitem_p.h>
 #include <private/verticalaxis_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -143,7 +144,7 @@ void VerticalAxis::updateGeometry()
         //items
         QGraphicsLineItem *gridItem = static_cast<QGraphicsLineItem *>(lines.at(i));
         QGraphicsLineItem *tickItem = static_cast<QGraphicsLineItem *>(arrow.at(i + 1));
-        QGraphicsTextItem *labelItem = static_cast<QGraphicsTextItem *>(labels.at(i));
+        ChartTextItem *labelItem = static_cast<ChartTextItem *>(labels.at(i));
 
         //grid line
         if (axis()->isReverse()) {
@@ -160,19 +161,21 @@ void VerticalAxis::updateGeometry()
         else
             text = labelList.at(i);
 
+        labelItem->setStaticTextEnabled(presenter()->plainTextLabels());
+
         QRectF boundingRect;
         // don't truncate empty labels
         if (text.isEmpty()) {
-            labelItem->setHtml(text);
+            labelItem->setText(text);
         } else {
             qreal labelHeight = (axisRect.height() / layout.count()) - (2 * labelPadding());
             QString truncatedText = ChartPresenter::truncatedText(axis()->labelsFont(), text,
                                                                   axis()->labelsAngle(),
                                                                   availableSpace,
                                                                   labelHeight, boundingRect);
-            labelItem->setTextWidth(ChartPresenter::textBoundingRect(axis()->labelsFont(),
-                                                                     truncatedText).width());
-            labelItem->setHtml(truncatedText);
+            labelItem->setText(truncatedText,
+                               ChartPresenter::textBoundingRect(axis()->labelsFont(),
+                                                                truncatedText).width());
         }
 
         //label transformation origin point
@@ -196,6 +196,7 @@ void AbstractBarChartItem::handleDomainUpdated()
 
 void AbstractBarChartItem::handleLayoutChanged()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     if ((m_rect.width() <= 0) || (m_rect.height() <= 0))
         return; // rect size zero.
     updateBarItems();
@@ -284,7 +285,7 @@ void AbstractBarChartItem::handleUpdatedBars()
                 if (updateLabels && actualBarCount > bar->index()) {
                     if (seriesLabelsDirty || setLabelsDirty || bar->labelDirty()) {
                         bar->setLabelDirty(false);
-                        QGraphicsTextItem *label = bar->labelItem();
+                        ChartTextItem *label = bar->labelItem();
                         QString valueLabel;
                         qreal value = barSetP->value(bar->index());
                         if (value == 0.0) {
@@ -293,8 +294,10 @@ void AbstractBarChartItem::handleUpdatedBars()
                             label->setVisible(m_series->isLabelsVisible());
                             valueLabel = generateLabelText(set, bar->index(), value);
                         }
-                        label->setHtml(valueLabel);
+                        // The font is needed for laying out the text
                         label->setFont(barSetP->m_labelFont);
+                        label->setStaticTextEnabled(presenter()->plainTextLabels());
+                        label->setText(valueLabel);
                         label->setDefaultTextColor(barSetP->m_labelBrush.color());
                         label->update();
                     }
@@ -502,11 +505,10 @@ void AbstractBarChartItem::createLabelItems()
 
     for (const QList<Bar *> &bars : qAsConst(m_barMap)) {
         for (Bar *bar :  bars) {
-            QGraphicsTextItem *label = bar->labelItem();
+            ChartTextItem *label = bar->labelItem();
             if (!label) {
-                QGraphicsTextItem *newLabel = new QGraphicsTextItem(this);
+                ChartTextItem *newLabel = new ChartTextItem(this);
                 newLabel->setAcceptHoverEvents(false);
-                newLabel->document()->setDocumentMargin(ChartPresenter::textMargin());
                 bar->setLabelItem(newLabel);
             }
         }
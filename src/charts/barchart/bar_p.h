@@ -43,6 +43,7 @@
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtWidgets/QGraphicsRectItem>
 #include <QtWidgets/QGraphicsTextItem>
+#include <private/charttextitem_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -69,8 +70,8 @@ public:
     void setLabelDirty(bool dirty) { m_labelDirty = dirty; }
     bool labelDirty() const { return m_labelDirty; }
 
-    void setLabelItem(QGraphicsTextItem *labelItem) { m_labelItem = labelItem; }
-    QGraphicsTextItem *labelItem() const { return m_labelItem; }
+    void setLabelItem(ChartTextItem *labelItem) { m_labelItem = labelItem; }
+    ChartTextItem *labelItem() const { return m_labelItem; }
 
     void setIndex(int index) { m_index = index; }
     int index() const { return m_index; }
@@ -88,7 +89,7 @@ private:
     int m_index;
     int m_layoutIndex;
     QBarSet *m_barset;
-    QGraphicsTextItem *m_labelItem;
+    ChartTextItem *m_labelItem;
     bool m_hovering;
     bool m_mousePressed;
     bool m_visualsDirty;
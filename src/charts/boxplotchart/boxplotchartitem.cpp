@@ -34,6 +34,7 @@
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBoxSet>
 #include <private/boxwhiskers_p.h>
+#include <private/chartpresenter_p.h>
 #include <QtGui/QPainter>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -180,6 +181,7 @@ void BoxPlotChartItem::handleDomainUpdated()
 
 void BoxPlotChartItem::handleLayoutChanged()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     foreach (BoxWhiskers *item, m_boxTable.values()) {
         if (m_animation)
             m_animation->setAnimationStart(item);
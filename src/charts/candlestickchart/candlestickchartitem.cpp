@@ -34,6 +34,7 @@
 #include <private/candlestickdata_p.h>
 #include <private/qcandlestickseries_p.h>
 #include <private/candlestickanimation_p.h>
+#include <private/chartpresenter_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -109,6 +110,7 @@ void CandlestickChartItem::handleDomainUpdated()
 
 void CandlestickChartItem::handleLayoutUpdated()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     bool timestampChanged = false;
     foreach (QCandlestickSet *set, m_candlesticks.keys()) {
         qreal oldTimestamp = m_candlesticks.value(set)->m_data.m_timestamp;
@@ -54,6 +54,7 @@ public:
     ChartItem(QAbstractSeriesPrivate *series,QGraphicsItem* item);
     AbstractDomain*  domain() const;
     virtual void cleanup();
+    virtual void handleScheduledUpdate() {}
 
 public Q_SLOTS:
     virtual void handleDomainUpdated();
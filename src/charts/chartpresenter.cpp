@@ -36,13 +36,18 @@
 #include <private/chartanimation_p.h>
 #include <private/qabstractseries_p.h>
 #include <QtCharts/QAreaSeries>
+#include <QtCharts/QAbstractBarSeries>
+#include <private/qabstractbarseries_p.h>
+#include <private/abstractbarchartitem_p.h>
 #include <private/chartaxiselement_p.h>
 #include <private/chartbackground_p.h>
 #include <private/cartesianchartlayout_p.h>
 #include <private/polarchartlayout_p.h>
 #include <private/charttitle_p.h>
+#include <QtCore/QCache>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QTimer>
+#include <QtGui/QFontMetricsF>
 #include <QtGui/QTextDocument>
 #include <QtWidgets/QGraphicsScene>
 #include <QtWidgets/QGraphicsView>
@@ -55,6 +60,8 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       m_options(QChart::NoAnimation),
       m_animationDuration(ChartAnimationDuration),
       m_animationCurve(QEasingCurve::OutQuart),
+      m_animationPointLimit(ChartAnimationPointLimit),
+      m_plainTextLabels(false),
       m_state(ShowState),
       m_background(0),
       m_plotAreaBackground(0),
@@ -64,12 +71,20 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       , m_glWidget(0)
       , m_glUseWidget(true)
 #endif
+      , m_deferredUpdates(false)
+      , m_maximumUpdateRate(0)
+      , m_updateRequestCount(0)
+      , m_coalescedUpdateCount(0)
+      , m_updatePassCount(0)
 {
     if (type == QChart::ChartTypeCartesian)
         m_layout = new CartesianChartLayout(this);
     else if (type == QChart::ChartTypePolar)
         m_layout = new PolarChartLayout(this);
     Q_ASSERT(m_layout);
+
+    m_updateTimer.setSingleShot(true);
+    connect(&m_updateTimer, &QTimer::timeout, this, &ChartPresenter::performScheduledUpdates);
 }
 
 ChartPresenter::~ChartPresenter()
@@ -170,6 +185,13 @@ void ChartPresenter::handleSeriesAdded(QAbstractSeries *series)
 void ChartPresenter::handleSeriesRemoved(QAbstractSeries *series)
 {
     ChartItem *chart  = series->d_ptr->m_item.take();
+    // Drop the scheduled updates of the item and of its child items, such as the bounds of
+    // an area series
+    for (int i = m_scheduledItems.size() - 1; i >= 0; --i) {
+        ChartItem *item = m_scheduledItems.at(i);
+        if (!item || item == chart || chart->isAncestorOf(item))
+            m_scheduledItems.removeAt(i);
+    }
     chart->hide();
     chart->cleanup();
     series->disconnect(chart);
@@ -223,6 +245,31 @@ void ChartPresenter::setAnimationEasingCurve(const QEasingCurve &curve)
     }
 }
 
+void ChartPresenter::setAnimationPointLimit(int limit)
+{
+    // Takes effect on the next change of each series
+    m_animationPointLimit = qMax(0, limit);
+}
+
+void ChartPresenter::setPlainTextLabels(bool enabled)
+{
+    if (m_plainTextLabels != enabled) {
+        m_plainTextLabels = enabled;
+        // Axis labels are set again on the next layout, bar labels once marked dirty
+        foreach (QAbstractSeries *series, m_series) {
+            if (qobject_cast<QAbstractBarSeries *>(series))
+                static_cast<QAbstractBarSeriesPrivate *>(series->d_ptr.data())->setLabelsDirty(true);
+        }
+        foreach (ChartItem *item, m_chartItems) {
+            if (AbstractBarChartItem *barItem = qobject_cast<AbstractBarChartItem *>(item)) {
+                barItem->handleUpdatedBars();
+                barItem->positionLabels();
+            }
+        }
+        m_layout->invalidate();
+    }
+}
+
 void ChartPresenter::setState(State state,QPointF point)
 {
 	m_state=state;
@@ -478,18 +525,111 @@ ChartTitle *ChartPresenter::titleElement()
     return m_title;
 }
 
-QRectF ChartPresenter::textBoundingRect(const QFont &font, const QString &text, qreal angle)
+typedef QPair<QFont, QString> TextCacheKey;
+static const int textCacheSize = 2048;
+static const int textDocumentMetricsSize = 64;
+
+static void clearTextMeasurementCache();
+
+struct TextMeasurementCache
+{
+    TextMeasurementCache()
+        : rects(textCacheSize),
+          hits(0),
+          misses(0)
+    {
+        // The fonts must not outlive the application
+        qAddPostRoutine(clearTextMeasurementCache);
+    }
+
+    // Unrotated text bounding rects. Axis labels are measured on every layout, most often
+    // with the same handful of texts, so the most recently used rects are kept.
+    QCache<TextCacheKey, QRectF> rects;
+    // Per font, the difference in width between the text document and the font metrics,
+    // and the height of a single line of text in the text document
+    QHash<QFont, QSizeF> documentMetrics;
+    int hits;
+    int misses;
+};
+
+Q_GLOBAL_STATIC(TextMeasurementCache, textMeasurementCache)
+
+static void clearTextMeasurementCache()
+{
+    textMeasurementCache()->rects.clear();
+    textMeasurementCache()->documentMetrics.clear();
+}
+
+static QRectF textDocumentBoundingRect(const QFont &font, const QString &text)
 {
     static QGraphicsTextItem dummyTextItem;
     static bool initMargin = true;
     if (initMargin) {
-        dummyTextItem.document()->setDocumentMargin(textMargin());
+        dummyTextItem.document()->setDocumentMargin(ChartPresenter::textMargin());
         initMargin = false;
     }
 
     dummyTextItem.setFont(font);
     dummyTextItem.setHtml(text);
-    QRectF boundingRect = dummyTextItem.boundingRect();
+    return dummyTextItem.boundingRect();
+}
+
+// Returns true if the text lays out as a single line of the same characters when it is set as
+// HTML, i.e. it contains no markup, no entities, and no whitespace that HTML would collapse.
+bool ChartPresenter::isPlainText(const QString &text)
+{
+    if (text.isEmpty() || text.at(0) == QLatin1Char(' ')
+            || text.at(text.length() - 1) == QLatin1Char(' ')) {
+        return false;
+    }
+    QChar previous;
+    for (const QChar c : text) {
+        if (c == QLatin1Char('<') || c == QLatin1Char('&')
+                || (c == QLatin1Char(' ') && previous == QLatin1Char(' '))
+                || (c != QLatin1Char(' ') && c.isSpace())) {
+            return false;
+        }
+        previous = c;
+    }
+    return true;
+}
+
+static QRectF measureText(const QFont &font, const QString &text)
+{
+    if (!ChartPresenter::isPlainText(text))
+        return textDocumentBoundingRect(font, text);
+
+    // A single line of plain text is as wide as its advance plus the document margins, and as
+    // high as any other line in the same font. The offsets are taken once per font from the
+    // text document, so that the result matches the document layout.
+    const QFontMetricsF fontMetrics(font);
+    QHash<QFont, QSizeF> &documentMetrics = textMeasurementCache()->documentMetrics;
+    auto metrics = documentMetrics.constFind(font);
+    if (metrics == documentMetrics.constEnd()) {
+        if (documentMetrics.size() >= textDocumentMetricsSize)
+            documentMetrics.clear();
+        const QString reference(QStringLiteral("0"));
+        const QRectF rect = textDocumentBoundingRect(font, reference);
+        const qreal widthOffset = rect.width() - fontMetrics.horizontalAdvance(reference);
+        metrics = documentMetrics.insert(font, QSizeF(widthOffset, rect.height()));
+    }
+    return QRectF(0, 0, fontMetrics.horizontalAdvance(text) + metrics->width(),
+                  metrics->height());
+}
+
+QRectF ChartPresenter::textBoundingRect(const QFont &font, const QString &text, qreal angle)
+{
+    TextMeasurementCache *cache = textMeasurementCache();
+    QRectF boundingRect;
+    const TextCacheKey key(font, text);
+    if (const QRectF *cachedRect = cache->rects.object(key)) {
+        ++cache->hits;
+        boundingRect = *cachedRect;
+    } else {
+        ++cache->misses;
+        boundingRect = measureText(font, text);
+        cache->rects.insert(key, new QRectF(boundingRect));
+    }
 
     // Take rotation into account
     if (angle) {
@@ -501,6 +641,24 @@ QRectF ChartPresenter::textBoundingRect(const QFont &font, const QString &text,
     return boundingRect;
 }
 
+int ChartPresenter::textCacheHitCount()
+{
+    return textMeasurementCache()->hits;
+}
+
+int ChartPresenter::textCacheMissCount()
+{
+    return textMeasurementCache()->misses;
+}
+
+// Clears the cached text measurements and resets the hit and miss counts
+void ChartPresenter::clearTextCache()
+{
+    clearTextMeasurementCache();
+    textMeasurementCache()->hits = 0;
+    textMeasurementCache()->misses = 0;
+}
+
 // boundingRect parameter returns the rotated bounding rect of the text
 QString ChartPresenter::truncatedText(const QFont &font, const QString &text, qreal angle,
                                       qreal maxWidth, qreal maxHeight, QRectF &boundingRect)
@@ -611,6 +769,82 @@ void ChartPresenter::updateGLWidget()
 #endif
 }
 
+void ChartPresenter::setDeferredUpdates(bool deferred)
+{
+    if (m_deferredUpdates != deferred) {
+        m_deferredUpdates = deferred;
+        if (!deferred)
+            performScheduledUpdates();
+    }
+}
+
+void ChartPresenter::setMaximumUpdateRate(int rate)
+{
+    m_maximumUpdateRate = qMax(0, rate);
+}
+
+// Schedules a geometry update for the item if deferred updates are enabled. The updates
+// scheduled for an item are coalesced into a single update, which is performed on the next
+// event loop iteration, or later if that would exceed the maximum update rate. Returns false if
+// updates are not deferred, in which case the caller should update right away.
+bool ChartPresenter::scheduleUpdate(ChartItem *item)
+{
+    if (!m_deferredUpdates)
+        return false;
+
+    ++m_updateRequestCount;
+    if (m_scheduledItems.contains(item)) {
+        ++m_coalescedUpdateCount;
+        return true;
+    }
+    m_scheduledItems.append(item);
+
+    if (!m_updateTimer.isActive()) {
+        int delay = 0;
+        if (m_maximumUpdateRate > 0 && m_lastUpdatePass.isValid())
+            delay = qMax(qint64(0), 1000 / m_maximumUpdateRate - m_lastUpdatePass.elapsed());
+        m_updateTimer.start(delay);
+    }
+    return true;
+}
+
+void ChartPresenter::performScheduledUpdates()
+{
+    m_updateTimer.stop();
+    if (m_scheduledItems.isEmpty())
+        return;
+
+    // Updates scheduled while updating are left for the next pass
+    const QList<QPointer<ChartItem> > items = m_scheduledItems;
+    m_scheduledItems.clear();
+    for (const QPointer<ChartItem> &item : items) {
+        if (item)
+            item->handleScheduledUpdate();
+    }
+
+    ++m_updatePassCount;
+    m_lastUpdatePass.start();
+}
+
+void ChartPresenter::resetUpdateCounters()
+{
+    m_updateRequestCount = 0;
+    m_coalescedUpdateCount = 0;
+    m_updatePassCount = 0;
+}
+
+void ChartPresenter::recordTiming(QChart::TimingCategory category, qint64 nsecs)
+{
+    m_timings.record(category, nsecs);
+    emit m_chart->timingRecorded(category, nsecs);
+}
+
+void ChartPresenter::endTimingFrame()
+{
+    if (m_timings.isEnabled())
+        m_timings.endFrame();
+}
+
 QT_CHARTS_END_NAMESPACE
 
 #include "moc_chartpresenter_p.cpp"
@@ -43,11 +43,14 @@
 #include <QtCharts/QChart> //because of QChart::ChartThemeId
 #include <QtCharts/private/qchartglobal_p.h>
 #include <private/glwidget_p.h>
+#include <private/charttimings_p.h>
 #include <QtCore/QRectF>
 #include <QtCore/QMargins>
 #include <QtCore/QLocale>
 #include <QtCore/QPointer>
 #include <QtCore/QEasingCurve>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -159,6 +162,11 @@ public:
     int animationDuration() const { return m_animationDuration; }
     void setAnimationEasingCurve(const QEasingCurve &curve);
     QEasingCurve animationEasingCurve() const { return m_animationCurve; }
+    void setAnimationPointLimit(int limit);
+    int animationPointLimit() const { return m_animationPointLimit; }
+
+    void setPlainTextLabels(bool enabled);
+    bool plainTextLabels() const { return m_plainTextLabels; }
 
     void startAnimation(ChartAnimation *animation);
 
@@ -174,6 +182,10 @@ public:
     static QString truncatedText(const QFont &font, const QString &text, qreal angle,
                                  qreal maxWidth, qreal maxHeight, QRectF &boundingRect);
     inline static qreal textMargin() { return qreal(0.5); }
+    static bool isPlainText(const QString &text);
+    static int textCacheHitCount();
+    static int textCacheMissCount();
+    static void clearTextCache();
 
     QString numberToString(double value, char f = 'g', int prec = 6);
     QString numberToString(int value);
@@ -181,6 +193,24 @@ public:
     void updateGLWidget();
     void glSetUseWidget(bool enable) { m_glUseWidget = enable; }
 
+    void setDeferredUpdates(bool deferred);
+    bool deferredUpdates() const { return m_deferredUpdates; }
+    void setMaximumUpdateRate(int rate);
+    int maximumUpdateRate() const { return m_maximumUpdateRate; }
+    bool scheduleUpdate(ChartItem *item);
+
+    int updateRequestCount() const { return m_updateRequestCount; }
+    int coalescedUpdateCount() const { return m_coalescedUpdateCount; }
+    int updatePassCount() const { return m_updatePassCount; }
+    void resetUpdateCounters();
+
+    void setTimingEnabled(bool enabled) { m_timings.setEnabled(enabled); }
+    bool isTimingEnabled() const { return m_timings.isEnabled(); }
+    const ChartTimings &timings() const { return m_timings; }
+    void recordTiming(QChart::TimingCategory category, qint64 nsecs);
+    void endTimingFrame();
+    void resetTimings() { m_timings.reset(); }
+
 private:
     void createBackgroundItem();
     void createPlotAreaBackgroundItem();
@@ -191,6 +221,7 @@ public Q_SLOTS:
     void handleSeriesRemoved(QAbstractSeries *series);
     void handleAxisAdded(QAbstractAxis *axis);
     void handleAxisRemoved(QAbstractAxis *axis);
+    void performScheduledUpdates();
 
 Q_SIGNALS:
     void plotAreaChanged(const QRectF &plotArea);
@@ -204,6 +235,8 @@ private:
     QChart::AnimationOptions m_options;
     int m_animationDuration;
     QEasingCurve m_animationCurve;
+    int m_animationPointLimit;
+    bool m_plainTextLabels;
     State m_state;
     QPointF m_statePoint;
     AbstractChartLayout *m_layout;
@@ -218,6 +251,42 @@ private:
 #endif
     bool m_glUseWidget;
     QRectF m_fixedRect;
+    // Items whose geometry update has been deferred to the next update pass, see scheduleUpdate().
+    // Guarded, as the bounds of an area series can be deleted while their update is pending.
+    bool m_deferredUpdates;
+    int m_maximumUpdateRate;
+    QList<QPointer<ChartItem> > m_scheduledItems;
+    QTimer m_updateTimer;
+    QElapsedTimer m_lastUpdatePass;
+    int m_updateRequestCount;
+    int m_coalescedUpdateCount;
+    int m_updatePassCount;
+    ChartTimings m_timings;
+};
+
+// Measures the time spent in its scope and records it in the presenter, if timing is enabled.
+// Checking the flag is all it costs when timing is disabled.
+class ChartTimingScope
+{
+public:
+    ChartTimingScope(ChartPresenter *presenter, QChart::TimingCategory category)
+        : m_presenter(presenter && presenter->isTimingEnabled() ? presenter : nullptr),
+          m_category(category)
+    {
+        if (m_presenter)
+            m_timer.start();
+    }
+    ~ChartTimingScope()
+    {
+        if (m_presenter)
+            m_presenter->recordTiming(m_category, m_timer.nsecsElapsed());
+    }
+
+private:
+    Q_DISABLE_COPY(ChartTimingScope)
+    ChartPresenter *m_presenter;
+    QChart::TimingCategory m_category;
+    QElapsedTimer m_timer;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -24,6 +24,8 @@ SOURCES += \
     $$PWD/chartitem.cpp \
     $$PWD/scroller.cpp \
     $$PWD/charttitle.cpp \
+    $$PWD/charttextitem.cpp \
+    $$PWD/charttimings.cpp \
     $$PWD/qpolarchart.cpp
 
 contains(QT_CONFIG, opengl): SOURCES += $$PWD/glwidget.cpp
@@ -41,6 +43,8 @@ PRIVATE_HEADERS += \
     $$PWD/scroller_p.h \
     $$PWD/qabstractseries_p.h \
     $$PWD/charttitle_p.h \
+    $$PWD/charttextitem_p.h \
+    $$PWD/charttimings_p.h \
     $$PWD/charthelpers_p.h \
     $$PWD/qchartglobal_p.h
 
@@ -0,0 +1,122 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/charttextitem_p.h>
+#include <private/chartpresenter_p.h>
+#include <QtGui/QPainter>
+#include <QtGui/QTextDocument>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+ChartTextItem::ChartTextItem(QGraphicsItem *parent)
+    : QGraphicsTextItem(parent),
+      m_textWidth(-1.0),
+      m_staticTextEnabled(false),
+      m_usingStaticText(false)
+{
+    document()->setDocumentMargin(ChartPresenter::textMargin());
+    m_staticText.setTextFormat(Qt::PlainText);
+}
+
+// Sets the text of the item. With a non-negative textWidth the item is that wide, as with
+// QGraphicsTextItem::setTextWidth(). The text is interpreted as HTML.
+void ChartTextItem::setText(const QString &text, qreal textWidth)
+{
+    if (m_usingStaticText && m_text == text && m_textWidth == textWidth
+            && m_staticTextFont == font()) {
+        return;
+    }
+    m_text = text;
+    m_textWidth = textWidth;
+    applyText();
+}
+
+// Static text is only used for texts that lay out the same way as plain text as they do as
+// HTML. The change takes effect on the next setText() call, unless static text gets disabled
+// while it is in use.
+void ChartTextItem::setStaticTextEnabled(bool enabled)
+{
+    if (m_staticTextEnabled != enabled) {
+        m_staticTextEnabled = enabled;
+        if (m_usingStaticText)
+            applyText();
+    }
+}
+
+void ChartTextItem::applyText()
+{
+    if (m_staticTextEnabled && canUseStaticText() && ChartPresenter::isPlainText(m_text)) {
+        prepareGeometryChange();
+        if (!m_usingStaticText) {
+            // Release the layout of the previous text
+            QGraphicsTextItem::setHtml(QString());
+            m_usingStaticText = true;
+        }
+        m_staticTextFont = font();
+        m_staticText.setText(m_text);
+        m_staticText.prepare(QTransform(), m_staticTextFont);
+        m_staticTextRect = ChartPresenter::textBoundingRect(m_staticTextFont, m_text);
+        if (m_textWidth >= 0.0)
+            m_staticTextRect.setWidth(m_textWidth);
+        update();
+    } else {
+        if (m_usingStaticText) {
+            prepareGeometryChange();
+            m_usingStaticText = false;
+            m_staticText.setText(QString());
+        }
+        QGraphicsTextItem::setTextWidth(m_textWidth);
+        QGraphicsTextItem::setHtml(m_text);
+    }
+}
+
+QRectF ChartTextItem::boundingRect() const
+{
+    if (m_usingStaticText)
+        return m_staticTextRect;
+    return QGraphicsTextItem::boundingRect();
+}
+
+void ChartTextItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+                          QWidget *widget)
+{
+    if (!m_usingStaticText) {
+        QGraphicsTextItem::paint(painter, option, widget);
+        return;
+    }
+
+    painter->save();
+    painter->setFont(m_staticTextFont);
+    painter->setPen(defaultTextColor());
+    const qreal margin = ChartPresenter::textMargin();
+    painter->drawStaticText(QPointF(margin, margin), m_staticText);
+    painter->restore();
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,88 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef CHARTTEXTITEM_P_H
+#define CHARTTEXTITEM_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtWidgets/QGraphicsTextItem>
+#include <QtGui/QStaticText>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Label item that draws text without markup from a QStaticText when static text is enabled,
+// and falls back to the rich text document of QGraphicsTextItem otherwise.
+class Q_CHARTS_PRIVATE_EXPORT ChartTextItem : public QGraphicsTextItem
+{
+public:
+    // The text is not painted from the document while static text is used, so the items
+    // are told apart from plain text items by their type
+    enum { Type = UserType + 3 };
+
+    ChartTextItem(QGraphicsItem *parent = nullptr);
+
+    int type() const { return Type; }
+
+    void setText(const QString &text, qreal textWidth = -1.0);
+    QString text() const { return m_text; }
+
+    void setStaticTextEnabled(bool enabled);
+    bool isStaticTextEnabled() const { return m_staticTextEnabled; }
+    bool isStaticText() const { return m_usingStaticText; }
+
+    QRectF boundingRect() const;
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
+
+protected:
+    virtual bool canUseStaticText() const { return true; }
+    void applyText();
+
+private:
+    QString m_text;
+    qreal m_textWidth;
+    bool m_staticTextEnabled;
+    bool m_usingStaticText;
+    QStaticText m_staticText;
+    QFont m_staticTextFont;
+    QRectF m_staticTextRect;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // CHARTTEXTITEM_P_H
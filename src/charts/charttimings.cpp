@@ -0,0 +1,98 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/charttimings_p.h>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+ChartTimings::ChartTimings()
+    : m_enabled(false)
+{
+    reset();
+}
+
+void ChartTimings::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+    m_enabled = enabled;
+    reset();
+}
+
+void ChartTimings::record(QChart::TimingCategory category, qint64 nsecs)
+{
+    m_currentFrame[category] += nsecs;
+}
+
+void ChartTimings::endFrame()
+{
+    m_lastFrame = (m_lastFrame + 1) % FrameWindow;
+    for (int category = 0; category < CategoryCount; ++category) {
+        m_frames[category][m_lastFrame] = m_currentFrame[category];
+        m_currentFrame[category] = 0;
+    }
+    m_frameCount = qMin(m_frameCount + 1, int(FrameWindow));
+}
+
+void ChartTimings::reset()
+{
+    for (int category = 0; category < CategoryCount; ++category) {
+        m_currentFrame[category] = 0;
+        for (int frame = 0; frame < FrameWindow; ++frame)
+            m_frames[category][frame] = 0;
+    }
+    m_frameCount = 0;
+    m_lastFrame = FrameWindow - 1;
+}
+
+qint64 ChartTimings::lastFrameTime(QChart::TimingCategory category) const
+{
+    return m_frameCount ? m_frames[category][m_lastFrame] : 0;
+}
+
+qint64 ChartTimings::averageFrameTime(QChart::TimingCategory category) const
+{
+    if (!m_frameCount)
+        return 0;
+    // Frames that have not been recorded yet are zero
+    qint64 sum = 0;
+    for (int frame = 0; frame < FrameWindow; ++frame)
+        sum += m_frames[category][frame];
+    return sum / m_frameCount;
+}
+
+qint64 ChartTimings::maximumFrameTime(QChart::TimingCategory category) const
+{
+    qint64 maximum = 0;
+    for (int frame = 0; frame < FrameWindow; ++frame)
+        maximum = qMax(maximum, m_frames[category][frame]);
+    return maximum;
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef CHARTTIMINGS_P_H
+#define CHARTTIMINGS_P_H
+
+#include <QtCharts/QChart>
+#include <QtCharts/private/qchartglobal_p.h>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Collects the time spent in each timing category of QChart. The times recorded between
+// two calls of endFrame() are summed up into a frame, and the statistics are computed over
+// the last FrameWindow frames.
+class Q_CHARTS_PRIVATE_EXPORT ChartTimings
+{
+public:
+    enum {
+        FrameWindow = 60,
+        CategoryCount = QChart::PaintTiming + 1
+    };
+
+    ChartTimings();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+
+    void record(QChart::TimingCategory category, qint64 nsecs);
+    void endFrame();
+    void reset();
+
+    int frameCount() const { return m_frameCount; }
+    qint64 lastFrameTime(QChart::TimingCategory category) const;
+    qint64 averageFrameTime(QChart::TimingCategory category) const;
+    qint64 maximumFrameTime(QChart::TimingCategory category) const;
+
+private:
+    bool m_enabled;
+    qint64 m_currentFrame[CategoryCount];
+    qint64 m_frames[CategoryCount][FrameWindow];
+    int m_frameCount;
+    int m_lastFrame;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // CHARTTIMINGS_P_H
@@ -34,7 +34,36 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-AbstractDomain::AbstractDomain(QObject *parent)
+namespace {
+
+// The per-point work of the geometry kernels is a single multiply-add per coordinate.
+// Whether a coordinate is logarithmic is a template parameter, so the loops have no
+// per-point branches and the linear variant can be vectorized by the compiler.
+template <bool LogX, bool LogY>
+bool mapCartesian(const QPointF *src, QPointF *dst, int count,
+                  qreal scaleX, qreal offsetX, qreal scaleY, qreal offsetY)
+{
+    bool ok = true;
+    for (int i = 0; i < count; ++i) {
+        qreal x = src[i].x();
+        qreal y = src[i].y();
+        if (LogX) {
+            ok &= x > 0;
+            x = std::log10(x);
+        }
+        if (LogY) {
+            ok &= y > 0;
+            y = std::log10(y);
+        }
+        dst[i].rx() = x * scaleX + offsetX;
+        dst[i].ry() = y * scaleY + offsetY;
+    }
+    return ok;
+}
+
+}
+
+
     : QObject(parent),
       m_minX(0),
       m_maxX(0),
@@ -300,6 +329,47 @@ QRectF AbstractDomain::fixZoomRect(const QRectF &rect)
     return fixRect;
 }
 
+/*!
+    \internal
+    Maps \a points to the geometry. A coordinate is mapped with (value - start) * delta and
+    mirrored over the plot area when the axis is reversed (x) or not reversed (y). When the
+    log base of an axis is non-zero, the logarithm of the value is used instead. Returns an
+    empty vector if a logarithm of zero or a negative value would be needed.
+*/
+QVector<QPointF> AbstractDomain::mapCartesianPoints(const QVector<QPointF> &points,
+                                                    qreal startX, qreal deltaX, qreal logBaseX,
+                                                    qreal startY, qreal deltaY, qreal logBaseY) const
+{
+    // Fold the reversing and the log base into a scale and an offset per axis
+    const qreal scaleX = (logBaseX != 0 ? deltaX / std::log10(logBaseX) : deltaX)
+            * (m_reverseX ? -1 : 1);
+    const qreal offsetX = m_reverseX ? m_size.width() + startX * deltaX : -startX * deltaX;
+    const qreal scaleY = (logBaseY != 0 ? deltaY / std::log10(logBaseY) : deltaY)
+            * (m_reverseY ? 1 : -1);
+    const qreal offsetY = m_reverseY ? -startY * deltaY : m_size.height() + startY * deltaY;
+
+    QVector<QPointF> result(points.size());
+    const QPointF *src = points.constData();
+    QPointF *dst = result.data();
+    const int count = points.size();
+
+    bool ok;
+    if (logBaseX != 0 && logBaseY != 0)
+        ok = mapCartesian<true, true>(src, dst, count, scaleX, offsetX, scaleY, offsetY);
+    else if (logBaseX != 0)
+        ok = mapCartesian<true, false>(src, dst, count, scaleX, offsetX, scaleY, offsetY);
+    else if (logBaseY != 0)
+        ok = mapCartesian<false, true>(src, dst, count, scaleX, offsetX, scaleY, offsetY);
+    else
+        ok = mapCartesian<false, false>(src, dst, count, scaleX, offsetX, scaleY, offsetY);
+
+    if (!ok) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
+    }
+    return result;
+}
+
 QT_CHARTS_END_NAMESPACE
 
 #include "moc_abstractdomain_p.cpp"
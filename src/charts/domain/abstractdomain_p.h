@@ -132,6 +132,9 @@ public Q_SLOTS:
 protected:
     void adjustLogDomainRanges(qreal &min, qreal &max);
     QRectF fixZoomRect(const QRectF &rect);
+    QVector<QPointF> mapCartesianPoints(const QVector<QPointF> &points,
+                                        qreal startX, qreal deltaX, qreal logBaseX,
+                                        qreal startY, qreal deltaY, qreal logBaseY) const;
 
     qreal m_minX;
     qreal m_maxX;
@@ -146,6 +146,12 @@ void LogXLogYPolarDomain::move(qreal dx, qreal dy)
     setRange(minX, maxX, minY, maxY);
 }
 
+QVector<QPointF> LogXLogYPolarDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
+{
+    return mapPolarPoints(vector, m_logLeftX, 360.0 / qAbs(m_logRightX - m_logLeftX), m_logBaseX,
+                          m_logInnerY, m_radius / qAbs(m_logOuterY - m_logInnerY), m_logBaseY);
+}
+
 qreal LogXLogYPolarDomain::toAngularCoordinate(qreal value, bool &ok) const
 {
     qreal retVal;
@@ -139,6 +139,12 @@ void LogXYPolarDomain::move(qreal dx, qreal dy)
     setRange(minX, maxX, minY, maxY);
 }
 
+QVector<QPointF> LogXYPolarDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
+{
+    return mapPolarPoints(vector, m_logLeftX, 360.0 / qAbs(m_logRightX - m_logLeftX), m_logBaseX,
+                          m_minY, m_radius / (m_maxY - m_minY), 0);
+}
+
 qreal LogXYPolarDomain::toAngularCoordinate(qreal value, bool &ok) const
 {
     qreal retVal;
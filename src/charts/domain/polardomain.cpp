@@ -30,9 +30,39 @@
 #include <private/polardomain_p.h>
 #include <private/qabstractaxis_p.h>
 #include <QtCore/QtMath>
+#include <cmath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+namespace {
+
+// See mapCartesian() in abstractdomain.cpp
+template <bool LogAngular, bool LogRadial>
+bool mapPolar(const QPointF *src, QPointF *dst, int count, const QPointF &center,
+              qreal scaleAngular, qreal offsetAngular, qreal scaleRadial, qreal offsetRadial)
+{
+    bool ok = true;
+    for (int i = 0; i < count; ++i) {
+        qreal a = src[i].x();
+        qreal r = src[i].y();
+        if (LogAngular) {
+            ok &= a > 0;
+            a = std::log10(a);
+        }
+        if (LogRadial) {
+            ok &= r > 0;
+            r = std::log10(r);
+        }
+        a = a * scaleAngular + offsetAngular;
+        r = qMax(r * scaleRadial + offsetRadial, qreal(0.0));
+        dst[i].rx() = center.x() + std::sin(a) * r;
+        dst[i].ry() = center.y() - std::cos(a) * r;
+    }
+    return ok;
+}
+
+}
+
 PolarDomain::PolarDomain(QObject *parent)
     : AbstractDomain(parent)
 {
@@ -95,6 +125,55 @@ QPointF PolarDomain::polarCoordinateToPoint(qreal angularCoordinate, qreal radia
     return QPointF(dx, -dy);
 }
 
+/*!
+    \internal
+    Maps \a points to the geometry. The angular coordinate in degrees is
+    (value - startAngular) * deltaAngular and the radial coordinate is
+    (value - startRadial) * deltaRadial, limited to the center. When a log base is non-zero,
+    the logarithm of the value is used instead. Returns an empty vector if a logarithm of
+    zero or a negative value would be needed.
+*/
+QVector<QPointF> PolarDomain::mapPolarPoints(const QVector<QPointF> &points,
+                                             qreal startAngular, qreal deltaAngular,
+                                             qreal logBaseAngular,
+                                             qreal startRadial, qreal deltaRadial,
+                                             qreal logBaseRadial) const
+{
+    // Fold the degree conversion and the log base into a scale and an offset per coordinate
+    const qreal scaleAngular = qDegreesToRadians(deltaAngular)
+            / (logBaseAngular != 0 ? std::log10(logBaseAngular) : 1.0);
+    const qreal offsetAngular = -qDegreesToRadians(startAngular * deltaAngular);
+    const qreal scaleRadial = deltaRadial
+            / (logBaseRadial != 0 ? std::log10(logBaseRadial) : 1.0);
+    const qreal offsetRadial = -startRadial * deltaRadial;
+
+    QVector<QPointF> result(points.size());
+    const QPointF *src = points.constData();
+    QPointF *dst = result.data();
+    const int count = points.size();
+
+    bool ok;
+    if (logBaseAngular != 0 && logBaseRadial != 0) {
+        ok = mapPolar<true, true>(src, dst, count, m_center, scaleAngular, offsetAngular,
+                                  scaleRadial, offsetRadial);
+    } else if (logBaseAngular != 0) {
+        ok = mapPolar<true, false>(src, dst, count, m_center, scaleAngular, offsetAngular,
+                                   scaleRadial, offsetRadial);
+    } else if (logBaseRadial != 0) {
+        ok = mapPolar<false, true>(src, dst, count, m_center, scaleAngular, offsetAngular,
+                                   scaleRadial, offsetRadial);
+    } else {
+        ok = mapPolar<false, false>(src, dst, count, m_center, scaleAngular, offsetAngular,
+                                    scaleRadial, offsetRadial);
+    }
+
+    if (!ok) {
+        qWarning() << "Logarithm of negative value is undefined. Empty layout returned.";
+        return QVector<QPointF>();
+    }
+    return result;
+}
+
 QT_CHARTS_END_NAMESPACE
 
 #include "moc_polardomain_p.cpp"
@@ -62,6 +62,9 @@ public:
 
 protected:
     QPointF polarCoordinateToPoint(qreal angularCoordinate, qreal radialCoordinate) const;
+    QVector<QPointF> mapPolarPoints(const QVector<QPointF> &points,
+                                    qreal startAngular, qreal deltaAngular, qreal logBaseAngular,
+                                    qreal startRadial, qreal deltaRadial, qreal logBaseRadial) const;
 
     QPointF m_center;
     qreal m_radius;
@@ -140,6 +140,12 @@ void XLogYPolarDomain::move(qreal dx, qreal dy)
     setRange(minX, maxX, minY, maxY);
 }
 
+QVector<QPointF> XLogYPolarDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
+{
+    return mapPolarPoints(vector, m_minX, 360.0 / (m_maxX - m_minX), 0,
+                          m_logInnerY, m_radius / qAbs(m_logOuterY - m_logInnerY), m_logBaseY);
+}
+
 qreal XLogYPolarDomain::toAngularCoordinate(qreal value, bool &ok) const
 {
     ok = true;
@@ -65,6 +65,7 @@ public:
     void move(qreal dx, qreal dy);
 
     QPointF calculateDomainPoint(const QPointF &point) const;
+    QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const;
 
     bool attachAxis(QAbstractAxis *axis);
     bool detachAxis(QAbstractAxis *axis);
@@ -179,20 +179,7 @@ QVector<QPointF> XYDomain::calculateGeometryPoints(const QVector<QPointF> &vecto
     const qreal deltaX = m_size.width() / xd;
     const qreal deltaY = m_size.height() / yd;
 
-    QVector<QPointF> result;
-    result.resize(vector.count());
-
-    for (int i = 0; i < vector.count(); ++i) {
-        qreal x = (vector[i].x() - m_minX) * deltaX;
-        if (m_reverseX)
-            x = m_size.width() - x;
-        qreal y = (vector[i].y() - m_minY) * deltaY;
-        if (!m_reverseY)
-            y = m_size.height() - y;
-        result[i].setX(x);
-        result[i].setY(y);
-    }
-    return result;
+    return mapCartesianPoints(vector, m_minX, deltaX, 0, m_minY, deltaY, 0);
 }
 
 QPointF XYDomain::calculateDomainPoint(const QPointF &point) const
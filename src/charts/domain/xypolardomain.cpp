@@ -142,6 +142,12 @@ QPointF XYPolarDomain::calculateDomainPoint(const QPointF &point) const
     return QPointF(a, r);
 }
 
+QVector<QPointF> XYPolarDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
+{
+    return mapPolarPoints(vector, m_minX, 360.0 / (m_maxX - m_minX), 0,
+                          m_minY, m_radius / (m_maxY - m_minY), 0);
+}
+
 qreal XYPolarDomain::toAngularCoordinate(qreal value, bool &ok) const
 {
     ok = true;
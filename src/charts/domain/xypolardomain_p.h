@@ -64,6 +64,7 @@ public:
     void move(qreal dx, qreal dy);
 
     QPointF calculateDomainPoint(const QPointF &point) const;
+    QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const;
 
 protected:
     qreal toAngularCoordinate(qreal value, bool &ok) const;
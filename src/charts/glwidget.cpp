@@ -346,27 +346,33 @@ void GLWidget::render(bool selection)
             m_program->setUniformValue(m_minUniformLoc, data->min);
             m_program->setUniformValue(m_deltaUniformLoc, data->delta);
             m_program->setUniformValue(m_matrixUniformLoc, data->matrix);
-            bool dirty = data->dirty;
+            bool arrayDirty = data->arrayDirty;
             if (!vbo) {
                 vbo = new QOpenGLBuffer;
                 m_seriesBufferMap.insert(i.key(), vbo);
                 vbo->create();
-                dirty = true;
+                arrayDirty = true;
             }
             vbo->bind();
-            if (dirty) {
-                vbo->allocate(data->array.constData(), data->array.count() * sizeof(GLfloat));
-                dirty = false;
+            if (arrayDirty || data->dirtyStart < data->dirtyEnd) {
+                // Changing the visible range only changes the uniforms, so the points are
+                // uploaded only when they have changed
+                GLXYSeriesDataManager::uploadPoints(vbo, data, arrayDirty);
+                data->arrayDirty = false;
+                data->dirtyStart = data->dirtyEnd = 0;
+            }
+            if (data->dirty) {
+                data->dirty = false;
                 m_selectionRenderNeeded = true;
             }
 
             glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
             if (data->type == QAbstractSeries::SeriesTypeLine) {
                 glLineWidth(data->width);
-                glDrawArrays(GL_LINE_STRIP, 0, data->array.size() / 2);
+                glDrawArrays(GL_LINE_STRIP, data->start, data->pointCount);
             } else { // Scatter
                 m_program->setUniformValue(m_pointSizeUniformLoc, data->width);
-                glDrawArrays(GL_POINTS, 0, data->array.size() / 2);
+                glDrawArrays(GL_POINTS, data->start, data->pointCount);
             }
             vbo->release();
         }
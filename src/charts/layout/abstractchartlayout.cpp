@@ -51,6 +51,7 @@ AbstractChartLayout::~AbstractChartLayout()
 
 void AbstractChartLayout::setGeometry(const QRectF &rect)
 {
+    ChartTimingScope timing(m_presenter, QChart::LayoutTiming);
     if (!rect.isValid())
         return;
     // If the chart has a fixed geometry then don't update visually
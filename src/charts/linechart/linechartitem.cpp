@@ -35,13 +35,45 @@
 #include <private/chartthememanager_p.h>
 #include <private/charttheme_p.h>
 #include <QtGui/QPainter>
+#include <QtCore/QtMath>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+static bool fitsIntLimits(const QRectF &rect)
+{
+    return rect.height() <= INT_MAX && rect.width() <= INT_MAX;
+}
+
+// Returns the rectangle spanned by the points from index up to end, or to the last point if end
+// is negative. This is much cheaper than taking the bounding rectangle of a path built from the
+// points.
+static QRectF pointsBoundingRect(const QVector<QPointF> &points, int index = 0, int end = -1)
+{
+    if (end < 0 || end > points.size())
+        end = int(points.size());
+    if (index >= end)
+        return QRectF();
+    qreal minX = points.at(index).x();
+    qreal maxX = minX;
+    qreal minY = points.at(index).y();
+    qreal maxY = minY;
+    for (int i = index + 1; i < end; ++i) {
+        const QPointF &point = points.at(i);
+        minX = qMin(minX, point.x());
+        maxX = qMax(maxX, point.x());
+        minY = qMin(minY, point.y());
+        maxY = qMax(maxY, point.y());
+    }
+    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+}
+
 LineChartItem::LineChartItem(QLineSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
+      m_pathsDirty(false),
+      m_shapeDirty(false),
+      m_lineStart(0),
       m_pointsVisible(false),
       m_chartType(QChart::ChartTypeUndefined),
       m_pointLabelsVisible(false),
@@ -74,11 +106,19 @@ QRectF LineChartItem::boundingRect() const
 
 QPainterPath LineChartItem::shape() const
 {
+    // Stroking the path is expensive for large series, so it is only done when the shape is
+    // needed, typically for hit testing.
+    if (m_shapeDirty) {
+        updatePaths();
+        m_shapePath = strokeShape(m_fullPath);
+        m_shapeDirty = false;
+    }
     return m_shapePath;
 }
 
 void LineChartItem::updateGeometry()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     if (m_series->useOpenGL()) {
         if (!m_rect.isEmpty()) {
             prepareGeometryChange();
@@ -92,12 +132,16 @@ void LineChartItem::updateGeometry()
     // Store the points to a local variable so that the old line gets properly cleared
     // when animation starts.
     m_linePoints = geometryPoints();
+    m_lineStart = 0;
+    m_pathsDirty = false;
     const QVector<QPointF> &points = m_linePoints;
 
     if (points.size() == 0) {
         prepareGeometryChange();
         m_fullPath = QPainterPath();
         m_linePath = QPainterPath();
+        m_shapePath = QPainterPath();
+        m_shapeDirty = false;
         m_rect = QRect();
         return;
     }
@@ -296,37 +340,171 @@ void LineChartItem::updateGeometry()
         fullPath = linePath;
     }
 
-    QPainterPathStroker stroker;
-    // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
-    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
-    // multiply line width with square root of two when defining shape and bounding rectangle.
-    stroker.setWidth(margin);
-    stroker.setJoinStyle(Qt::MiterJoin);
-    stroker.setCapStyle(Qt::SquareCap);
-    stroker.setMiterLimit(m_linePen.miterLimit());
+    // The bounding rect is the extent of the path grown by the largest distance the stroked
+    // shape or the point markers can reach beyond it. The polar paths include segments to the
+    // center and point ellipses, so their control points are used instead of the geometry points.
+    const QRectF rect = (chartType == QChart::ChartTypePolar)
+            ? fullPath.controlPointRect() : pointsBoundingRect(points);
+    const qreal extent = strokeExtent();
+    const QRectF boundingRect = rect.adjusted(-extent, -extent, extent, extent);
 
-    QPainterPath checkShapePath = stroker.createStroke(fullPath);
-
-    // Only zoom in if the bounding rects of the paths fit inside int limits. QWidget::update() uses
+    // Only zoom in if the bounding rect fits inside int limits. QWidget::update() uses
     // a region that has to be compatible with QRect.
-    if (checkShapePath.boundingRect().height() <= INT_MAX
-            && checkShapePath.boundingRect().width() <= INT_MAX
-            && linePath.boundingRect().height() <= INT_MAX
-            && linePath.boundingRect().width() <= INT_MAX
-            && fullPath.boundingRect().height() <= INT_MAX
-            && fullPath.boundingRect().width() <= INT_MAX) {
+    if (fitsIntLimits(boundingRect)) {
         prepareGeometryChange();
 
         m_linePath = linePath;
         m_fullPath = fullPath;
-        m_shapePath = checkShapePath;
+        m_shapePath = QPainterPath();
+        m_shapeDirty = true;
 
-        m_rect = m_shapePath.boundingRect();
+        m_rect = boundingRect;
     } else {
         update();
     }
 }
 
+void LineChartItem::updateGeometryAppended(int index, int count)
+{
+    QChart::ChartType chartType = m_chartType;
+    if (chartType == QChart::ChartTypeUndefined)
+        chartType = m_series->chart()->chartType();
+
+    // Only a plain line can be extended segment by segment. Polar charts and visible points
+    // need the whole path, and the geometry may be out of sync if an update was skipped.
+    if (m_series->useOpenGL() || chartType == QChart::ChartTypePolar || m_pointsVisible
+            || m_linePoints.size() <= m_lineStart || m_linePoints.size() - m_lineStart != index
+            || m_points.size() != index + count) {
+        updateGeometry();
+        return;
+    }
+
+    const int segmentStart = m_linePoints.size() - 1;
+    for (int i = index; i < index + count; i++)
+        m_linePoints.append(m_points.at(i));
+    const qreal extent = strokeExtent();
+    const QRectF segmentRect = pointsBoundingRect(m_linePoints, segmentStart)
+            .adjusted(-extent, -extent, extent, extent);
+    const QRectF rect = m_rect.united(segmentRect);
+    if (!fitsIntLimits(rect)) {
+        // The points have been appended, but the path has not, so it is all built again
+        updateGeometry();
+        return;
+    }
+
+    if (rect != m_rect)
+        prepareGeometryChange();
+    else
+        update(segmentRect);
+
+    if (!m_pathsDirty) {
+        // Drop the reference held by the full path first, so that the line path is extended
+        // in place rather than detached and copied.
+        m_fullPath = QPainterPath();
+        for (int i = index; i < index + count; i++)
+            m_linePath.lineTo(m_points.at(i));
+        m_fullPath = m_linePath;
+    }
+    m_shapePath = QPainterPath();
+    m_shapeDirty = true;
+    m_rect = rect;
+}
+
+// Called when the oldest points of a full series have made room for count appended points. A plain
+// solid line is drawn segment by segment from its points, so the removed points are skipped by
+// moving the start of the line instead of moving the kept points, and the paths are only built
+// when they are needed. The skipped points are dropped once there are as many of them as kept
+// points.
+void LineChartItem::updateGeometryShifted(int removed, int count)
+{
+    QChart::ChartType chartType = m_chartType;
+    if (chartType == QChart::ChartTypeUndefined)
+        chartType = m_series->chart()->chartType();
+
+    if (m_series->useOpenGL() || chartType == QChart::ChartTypePolar || m_pointsVisible
+            || m_pointLabelsVisible || m_linePen.style() != Qt::SolidLine
+            || m_linePoints.size() - m_lineStart != m_points.size() - count + removed
+            || m_linePoints.size() - m_lineStart <= removed) {
+        updateGeometry();
+        return;
+    }
+
+    // The segments of the removed points are cleared, and those of the appended points drawn
+    QRectF changedRect = pointsBoundingRect(m_linePoints, m_lineStart,
+                                            m_lineStart + removed + 1);
+    m_lineStart += removed;
+    const int segmentStart = m_linePoints.size() - 1;
+    for (int i = m_points.size() - count; i < m_points.size(); i++)
+        m_linePoints.append(m_points.at(i));
+    const qreal extent = strokeExtent();
+    changedRect = changedRect.united(pointsBoundingRect(m_linePoints, segmentStart))
+            .adjusted(-extent, -extent, extent, extent);
+    QRectF rect = m_rect.united(changedRect);
+    if (m_lineStart >= m_linePoints.size() - m_lineStart) {
+        m_linePoints.remove(0, m_lineStart);
+        m_lineStart = 0;
+        rect = pointsBoundingRect(m_linePoints).adjusted(-extent, -extent, extent, extent);
+    }
+    if (!fitsIntLimits(rect)) {
+        // The line points have already been shifted, so the whole geometry is built again
+        updateGeometry();
+        return;
+    }
+
+    if (rect != m_rect)
+        prepareGeometryChange();
+    update(changedRect);
+
+    m_pathsDirty = true;
+    m_shapePath = QPainterPath();
+    m_shapeDirty = true;
+    m_rect = rect;
+}
+
+// Builds the paths of a plain line from its points, if they have been left out of date by
+// updateGeometryShifted()
+void LineChartItem::updatePaths() const
+{
+    if (!m_pathsDirty)
+        return;
+
+    QPainterPath linePath;
+    if (m_lineStart < m_linePoints.size()) {
+        linePath.moveTo(m_linePoints.at(m_lineStart));
+        for (int i = m_lineStart + 1; i < m_linePoints.size(); i++)
+            linePath.lineTo(m_linePoints.at(i));
+    }
+    m_linePath = linePath;
+    m_fullPath = linePath;
+    m_pathsDirty = false;
+}
+
+// Returns how far the stroked shape and the point markers can extend beyond the path
+qreal LineChartItem::strokeExtent() const
+{
+    // strokeShape() uses a pen 1.42 times as wide as the line pen, whose miter joins and square
+    // caps reach out at most miterLimit and sqrt(2) times half that width, respectively.
+    const qreal halfWidth = m_linePen.width() * 1.42 / 2;
+    qreal extent = halfWidth * qMax(m_linePen.miterLimit(), qreal(M_SQRT2));
+    if (m_pointsVisible)
+        extent = qMax(extent, m_linePen.width() * qreal(1.5));
+    return extent + 1;
+}
+
+QPainterPath LineChartItem::strokeShape(const QPainterPath &path) const
+{
+    QPainterPathStroker stroker;
+    // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
+    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
+    // multiply line width with square root of two when defining shape and bounding rectangle.
+    stroker.setWidth(m_linePen.width() * 1.42);
+    stroker.setJoinStyle(Qt::MiterJoin);
+    stroker.setCapStyle(Qt::SquareCap);
+    stroker.setMiterLimit(m_linePen.miterLimit());
+
+    return stroker.createStroke(path);
+}
+
 void LineChartItem::handleUpdated()
 {
     // If points visibility has changed, a geometry update is needed.
@@ -334,6 +512,12 @@ void LineChartItem::handleUpdated()
     bool doGeometryUpdate =
         (m_pointsVisible != m_series->pointsVisible())
         || (m_series->pointsVisible() && (m_linePen != m_series->pen()));
+    // Decimation is not applied while points or point labels are visible, and points outside
+    // the plot area are not culled while point labels are visible, so toggling those requires
+    // the geometry points to be recalculated.
+    bool recalculatePoints = m_pointLabelsVisible != m_series->pointLabelsVisible()
+        || (m_series->decimationMode() != QLineSeries::NoDecimation
+            && m_pointsVisible != m_series->pointsVisible());
     bool visibleChanged = m_series->isVisible() != isVisible();
     setVisible(m_series->isVisible());
     setOpacity(m_series->opacity());
@@ -345,7 +529,9 @@ void LineChartItem::handleUpdated()
     m_pointLabelsColor = m_series->pointLabelsColor();
     bool labelClippingChanged = m_pointLabelsClipping != m_series->pointLabelsClipping();
     m_pointLabelsClipping = m_series->pointLabelsClipping();
-    if (doGeometryUpdate)
+    if (recalculatePoints && presenter() && !m_series->useOpenGL())
+        handleDomainUpdated();
+    else if (doGeometryUpdate)
         updateGeometry();
     else if (m_series->useOpenGL() && visibleChanged)
         refreshGlChart();
@@ -398,9 +584,10 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
 
     if (m_linePen.style() != Qt::SolidLine || alwaysUsePath) {
         // If pen style is not solid line, use path painting to ensure proper pattern continuity
+        updatePaths();
         painter->drawPath(m_linePath);
     } else {
-        for (int i = 1; i < m_linePoints.size(); ++i)
+        for (int i = m_lineStart + 1; i < m_linePoints.size(); ++i)
             painter->drawLine(m_linePoints.at(i - 1), m_linePoints.at(i));
     }
 
@@ -409,7 +596,10 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
             painter->setClipping(true);
         else
             painter->setClipping(false);
-        m_series->d_func()->drawSeriesPointLabels(painter, m_linePoints, m_linePen.width() / 2);
+        m_series->d_func()->drawSeriesPointLabels(painter,
+                                                  m_lineStart ? m_linePoints.mid(m_lineStart)
+                                                              : m_linePoints,
+                                                  m_linePen.width() / 2);
     }
 
     painter->restore();
@@ -419,7 +609,7 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         qreal ptSize = m_linePen.width() * 1.5;
         painter->setPen(Qt::NoPen);
         painter->setBrush(m_linePen.color());
-        for (int i = 0; i < m_linePoints.size(); ++i) {
+        for (int i = m_lineStart; i < m_linePoints.size(); ++i) {
             if (clipRect.contains(m_linePoints.at(i)))
                 painter->drawEllipse(m_linePoints.at(i), ptSize, ptSize);
         }
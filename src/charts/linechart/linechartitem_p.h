@@ -63,13 +63,15 @@ public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
     QPainterPath shape() const;
 
-    QPainterPath path() const { return m_fullPath; }
+    QPainterPath path() const { updatePaths(); return m_fullPath; }
 
 public Q_SLOTS:
     void handleUpdated();
 
 protected:
     void updateGeometry();
+    void updateGeometryAppended(int index, int count);
+    void updateGeometryShifted(int removed, int count);
     void mousePressEvent(QGraphicsSceneMouseEvent *event);
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
     void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
@@ -79,14 +81,25 @@ protected:
     void forceChartType(QChart::ChartType chartType) { m_chartType = chartType; }
 
 private:
+    QPainterPath strokeShape(const QPainterPath &path) const;
+    qreal strokeExtent() const;
+    void updatePaths() const;
+
     QLineSeries *m_series;
-    QPainterPath m_linePath;
+    // Built from m_linePoints on demand when m_pathsDirty is set, see updateGeometryShifted()
+    mutable QPainterPath m_linePath;
     QPainterPath m_linePathPolarRight;
     QPainterPath m_linePathPolarLeft;
-    QPainterPath m_fullPath;
-    QPainterPath m_shapePath;
-
+    mutable QPainterPath m_fullPath;
+    mutable bool m_pathsDirty;
+    // Stroked from m_fullPath on demand, see shape()
+    mutable QPainterPath m_shapePath;
+    mutable bool m_shapeDirty;
+
+    // The line is drawn from the points starting at m_lineStart, the points before it have been
+    // shifted out of a full series
     QVector<QPointF> m_linePoints;
+    int m_lineStart;
     QRectF m_rect;
     QPen m_linePen;
     bool m_pointsVisible;
@@ -104,6 +104,72 @@ QT_CHARTS_BEGIN_NAMESPACE
     \sa Qt::PenCapStyle
 */
 
+/*!
+    \enum QLineSeries::DecimationMode
+    \since 6.0
+
+    This enum describes how the series data is reduced before it is drawn.
+
+    \value NoDecimation
+           Every data point is drawn.
+    \value MinMaxDecimation
+           The first, the lowest, the highest, and the last data point within each pixel
+           column of the plot area are drawn. The result is visually identical to drawing
+           all the data points.
+    \value LttbDecimation
+           The data is downsampled to one point per pixel column using the
+           Largest-Triangle-Three-Buckets algorithm. This preserves the visual shape of the
+           data but may omit narrow spikes.
+*/
+
+/*!
+    \property QLineSeries::decimationMode
+    \brief The method used to reduce the number of drawn data points.
+    \since 6.0
+
+    When decimation is enabled, only the data points within the visible x-range are processed
+    and the number of drawn points is proportional to the width of the plot area instead of the
+    number of data points in the series. Changing the visible range of the chart decimates the
+    data again.
+
+    With QLineSeries::MinMaxDecimation, the series keeps a summary of the lowest and the
+    highest values of groups of consecutive data points at several resolutions. The summary
+    is built when the data is first decimated and extended when data points are appended,
+    and the coarsest resolution that still has a group per pixel column is drawn. This makes
+    zooming out on a large series cost time proportional to the width of the plot area
+    rather than to the number of data points. As the groups do not align with the pixel
+    columns, the drawn line can differ slightly from decimating each pixel column. Changes
+    other than appending data points discard the summary, which is then built again when
+    it is next needed.
+
+    Decimation requires the data points to be sorted by ascending x-coordinate. It is not
+    applied to series whose data is not sorted, to series that have visible data points or data
+    point labels, or to series in polar charts.
+
+    By default, the mode is QLineSeries::NoDecimation.
+*/
+/*!
+    \qmlproperty enumeration LineSeries::decimationMode
+    \since QtCharts 2.15
+    The method used to reduce the number of drawn data points.
+
+    \value LineSeries.NoDecimation
+           Every data point is drawn. This is the default value.
+    \value LineSeries.MinMaxDecimation
+           The first, the lowest, the highest, and the last data point within each pixel
+           column of the plot area are drawn.
+    \value LineSeries.LttbDecimation
+           The data is downsampled to one point per pixel column using the
+           Largest-Triangle-Three-Buckets algorithm.
+
+    \sa QLineSeries::decimationMode
+*/
+/*!
+    \fn void QLineSeries::decimationModeChanged(QLineSeries::DecimationMode mode)
+    \since 6.0
+    This signal is emitted when the decimation mode changes to \a mode.
+*/
+
 /*!
     Constructs an empty series object that is a child of \a parent.
     When the series object is added to a QChartView or QChart instance, the ownership
@@ -142,6 +208,23 @@ QAbstractSeries::SeriesType QLineSeries::type() const
     return QAbstractSeries::SeriesTypeLine;
 }
 
+void QLineSeries::setDecimationMode(QLineSeries::DecimationMode mode)
+{
+    Q_D(QLineSeries);
+    if (d->m_decimationMode != mode) {
+        d->m_decimationMode = mode;
+        if (mode != MinMaxDecimation)
+            d->m_minMaxPyramid.clear();
+        emit decimationModeChanged(mode);
+    }
+}
+
+QLineSeries::DecimationMode QLineSeries::decimationMode() const
+{
+    Q_D(const QLineSeries);
+    return d->m_decimationMode;
+}
+
 /*
 QDebug operator<< (QDebug debug, const QLineSeries series)
 {
@@ -157,7 +240,8 @@ QDebug operator<< (QDebug debug, const QLineSeries series)
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QLineSeriesPrivate::QLineSeriesPrivate(QLineSeries *q)
-    : QXYSeriesPrivate(q)
+    : QXYSeriesPrivate(q),
+      m_decimationMode(QLineSeries::NoDecimation)
 {
 
 }
@@ -41,12 +41,27 @@ class QLineSeriesPrivate;
 class Q_CHARTS_EXPORT QLineSeries : public QXYSeries
 {
     Q_OBJECT
+    Q_PROPERTY(DecimationMode decimationMode READ decimationMode WRITE setDecimationMode NOTIFY decimationModeChanged)
+    Q_ENUMS(DecimationMode)
+
+public:
+    enum DecimationMode {
+        NoDecimation = 0,
+        MinMaxDecimation,
+        LttbDecimation
+    };
 
 public:
     explicit QLineSeries(QObject *parent = nullptr);
     ~QLineSeries();
     QAbstractSeries::SeriesType type() const;
 
+    void setDecimationMode(DecimationMode mode);
+    DecimationMode decimationMode() const;
+
+Q_SIGNALS:
+    void decimationModeChanged(QLineSeries::DecimationMode mode);
+
 protected:
     QLineSeries(QLineSeriesPrivate &d, QObject *parent = nullptr);
 
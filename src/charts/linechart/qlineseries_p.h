@@ -40,6 +40,7 @@
 #define QLINESERIES_P_H
 
 #include <private/qxyseries_p.h>
+#include <QtCharts/QLineSeries>
 #include <QtCharts/private/qchartglobal_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -52,6 +53,9 @@ public:
     void initializeGraphics(QGraphicsItem* parent);
     void initializeTheme(int index, ChartTheme* theme, bool forced = false);
 
+protected:
+    QLineSeries::DecimationMode m_decimationMode;
+
 private:
     Q_DECLARE_PUBLIC(QLineSeries);
 };
@@ -138,6 +138,7 @@ void PieChartItem::handleDomainUpdated()
 
 void PieChartItem::updateLayout()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     // find pie center coordinates
     m_pieCenter.setX(m_rect.left() + (m_rect.width() * m_series->horizontalPosition()));
     m_pieCenter.setY(m_rect.top() + (m_rect.height() * m_series->verticalPosition()));
@@ -33,12 +33,14 @@
 #include <private/qlegend_p.h>
 #include <private/chartbackground_p.h>
 #include <QtCharts/QAbstractAxis>
+#include <QtCharts/QXYSeries>
 #include <private/abstractchartlayout_p.h>
 #include <private/charttheme_p.h>
 #include <private/chartpresenter_p.h>
 #include <private/chartdataset_p.h>
 #include <QtWidgets/QGraphicsScene>
 #include <QGraphicsSceneResizeEvent>
+#include <QtCore/QtMath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -101,6 +103,23 @@ QT_CHARTS_BEGIN_NAMESPACE
         A polar chart.
  */
 
+/*!
+ \enum QChart::TimingCategory
+ \since 6.0
+
+ This enum describes the parts of a frame that are timed when \l timingEnabled is \c true.
+
+ \value LayoutTiming
+        Laying out the chart, including the geometry and axis updates caused by the layout.
+ \value GeometryTiming
+        Updating the drawn geometry of the series.
+ \value AxisTiming
+        Laying out the axes and generating their labels.
+ \value PaintTiming
+        Painting the chart. Only measured when the chart is shown by a QChartView or by the
+        ChartView QML type.
+ */
+
 /*!
  \class QChart
  \inmodule QtCharts
@@ -133,6 +152,33 @@ QT_CHARTS_BEGIN_NAMESPACE
  \brief The easing curve of the animation for the chart.
  */
 
+/*!
+ \property QChart::animationPointLimit
+ \brief The maximum number of points of an animated series.
+ \since 6.0
+
+ Changes to line, spline, and scatter series with more points than this are not animated even
+ if series animations are enabled, as interpolating every point on every animation frame gets
+ expensive for large series. The value \c 0 does not limit the number of points.
+ Defaults to 10000.
+
+ \sa animationOptions
+ */
+
+/*!
+ \property QChart::plainTextLabels
+ \brief Whether axis and bar labels without markup are drawn as plain text.
+ \since 6.0
+
+ By default, labels are laid out as rich text, which is expensive to update for charts with
+ many labels. When this property is \c true, labels that contain no HTML markup, entities, or
+ collapsible whitespace are drawn from a cached plain text layout instead. Labels with markup,
+ and labels of editable axes, are still laid out as rich text.
+ Defaults to \c false.
+
+ \sa QAbstractAxis::setLabelsEditable()
+ */
+
 /*!
  \property QChart::backgroundVisible
  \brief Whether the chart background is visible.
@@ -219,6 +265,65 @@ QT_CHARTS_BEGIN_NAMESPACE
   \sa localizeNumbers
 */
 
+/*!
+  \property QChart::deferredUpdates
+  \brief Whether series changes are applied to the chart on the next event loop iteration.
+  \since 6.0
+
+  By default, every change to the data of a line, spline, scatter, or area series updates the
+  drawn geometry of the series right away. When the data of many series is changed, or a series
+  is changed many times in a row, most of that work is thrown away. When this property is
+  \c{true}, the geometry updates are deferred and all the changes made to a series since the
+  previous update are applied in a single update on the next event loop iteration. The
+  \l maximumUpdateRate property can be used to limit how often these updates are performed.
+
+  Setting this property to \c{false} applies the pending changes right away.
+  Defaults to \c{false}.
+
+  \sa maximumUpdateRate
+*/
+
+/*!
+  \property QChart::maximumUpdateRate
+  \brief The maximum number of deferred updates performed per second.
+  \since 6.0
+
+  When \l deferredUpdates is \c{true}, the changes made to the series are applied at most this
+  many times per second. Changes made in between are collected into the next update. The
+  value \c 0 does not limit the update rate, in which case the changes are applied on the next
+  event loop iteration. Defaults to \c 0.
+
+  \sa deferredUpdates
+*/
+
+/*!
+  \property QChart::timingEnabled
+  \brief Whether the time spent in the parts of each frame is recorded.
+  \since 6.0
+
+  When this property is \c{true}, the time spent in laying out the chart, updating the series
+  geometry, laying out the axes, and painting the chart is measured and summed up per frame.
+  The statistics over the last 60 frames can be queried with lastFrameTime(),
+  averageFrameTime(), and maximumFrameTime(), and the timingRecorded() signal is emitted for
+  each measurement. As the layout of the chart updates the series and the axes, the layout time
+  includes part of the geometry and axis times.
+
+  A frame ends when the chart has been painted, so only the charts shown by a QChartView or by
+  the ChartView QML type collect frame statistics. Timing is disabled by default, in which case
+  it adds no measurable overhead. Changing this property resets the collected timings.
+
+  \sa TimingCategory
+*/
+
+/*!
+  \fn void QChart::timingRecorded(QChart::TimingCategory category, qint64 nsecs)
+  \since 6.0
+
+  This signal is emitted when \l timingEnabled is \c true and a part of a frame belonging to
+  \a category has taken \a nsecs nanoseconds. A slot connected to this signal should not
+  change the chart, as the signal is emitted in the middle of updating or painting it.
+*/
+
 /*!
   \property QChart::plotArea
   \brief The rectangle within which the chart is drawn.
@@ -669,6 +774,139 @@ QLocale QChart::locale() const
     return d_ptr->m_presenter->locale();
 }
 
+void QChart::setDeferredUpdates(bool deferred)
+{
+    d_ptr->m_presenter->setDeferredUpdates(deferred);
+}
+
+bool QChart::deferredUpdates() const
+{
+    return d_ptr->m_presenter->deferredUpdates();
+}
+
+void QChart::setMaximumUpdateRate(int rate)
+{
+    d_ptr->m_presenter->setMaximumUpdateRate(rate);
+}
+
+int QChart::maximumUpdateRate() const
+{
+    return d_ptr->m_presenter->maximumUpdateRate();
+}
+
+/*!
+  \since 6.0
+  Returns the number of series changes that requested a deferred update since the counters
+  were last reset.
+
+  \sa deferredUpdates, coalescedUpdateCount(), updatePassCount(), resetUpdateCounters()
+*/
+int QChart::updateRequestCount() const
+{
+    return d_ptr->m_presenter->updateRequestCount();
+}
+
+/*!
+  \since 6.0
+  Returns the number of deferred update requests that were merged into an update already
+  pending for the same series since the counters were last reset.
+
+  \sa deferredUpdates, updateRequestCount(), resetUpdateCounters()
+*/
+int QChart::coalescedUpdateCount() const
+{
+    return d_ptr->m_presenter->coalescedUpdateCount();
+}
+
+/*!
+  \since 6.0
+  Returns the number of update passes that applied the deferred updates since the counters
+  were last reset.
+
+  \sa deferredUpdates, maximumUpdateRate, resetUpdateCounters()
+*/
+int QChart::updatePassCount() const
+{
+    return d_ptr->m_presenter->updatePassCount();
+}
+
+/*!
+  \since 6.0
+  Resets the deferred update counters to zero.
+
+  \sa updateRequestCount(), coalescedUpdateCount(), updatePassCount()
+*/
+void QChart::resetUpdateCounters()
+{
+    d_ptr->m_presenter->resetUpdateCounters();
+}
+
+void QChart::setTimingEnabled(bool enabled)
+{
+    d_ptr->m_presenter->setTimingEnabled(enabled);
+}
+
+bool QChart::isTimingEnabled() const
+{
+    return d_ptr->m_presenter->isTimingEnabled();
+}
+
+/*!
+  \since 6.0
+  Returns the time in nanoseconds spent in \a category during the last frame, or \c 0 if no
+  frame has been timed.
+
+  \sa timingEnabled, averageFrameTime(), maximumFrameTime()
+*/
+qint64 QChart::lastFrameTime(QChart::TimingCategory category) const
+{
+    return d_ptr->m_presenter->timings().lastFrameTime(category);
+}
+
+/*!
+  \since 6.0
+  Returns the average time in nanoseconds spent in \a category over the last 60 frames.
+
+  \sa timingEnabled, timedFrameCount()
+*/
+qint64 QChart::averageFrameTime(QChart::TimingCategory category) const
+{
+    return d_ptr->m_presenter->timings().averageFrameTime(category);
+}
+
+/*!
+  \since 6.0
+  Returns the longest time in nanoseconds spent in \a category in any of the last 60 frames.
+
+  \sa timingEnabled, timedFrameCount()
+*/
+qint64 QChart::maximumFrameTime(QChart::TimingCategory category) const
+{
+    return d_ptr->m_presenter->timings().maximumFrameTime(category);
+}
+
+/*!
+  \since 6.0
+  Returns the number of frames the timing statistics are computed over. This is at most 60.
+
+  \sa timingEnabled, resetTimings()
+*/
+int QChart::timedFrameCount() const
+{
+    return d_ptr->m_presenter->timings().frameCount();
+}
+
+/*!
+  \since 6.0
+  Discards the timings recorded so far.
+
+  \sa timingEnabled
+*/
+void QChart::resetTimings()
+{
+    d_ptr->m_presenter->resetTimings();
+}
+
 void QChart::setAnimationOptions(AnimationOptions options)
 {
     d_ptr->m_presenter->setAnimationOptions(options);
@@ -699,6 +937,26 @@ QEasingCurve QChart::animationEasingCurve() const
     return d_ptr->m_presenter->animationEasingCurve();
 }
 
+void QChart::setAnimationPointLimit(int limit)
+{
+    d_ptr->m_presenter->setAnimationPointLimit(limit);
+}
+
+int QChart::animationPointLimit() const
+{
+    return d_ptr->m_presenter->animationPointLimit();
+}
+
+void QChart::setPlainTextLabels(bool enabled)
+{
+    d_ptr->m_presenter->setPlainTextLabels(enabled);
+}
+
+bool QChart::plainTextLabels() const
+{
+    return d_ptr->m_presenter->plainTextLabels();
+}
+
 /*!
     Scrolls the visible area of the chart by the distance specified by \a dx and \a dy.
 
@@ -839,6 +1097,46 @@ QPointF QChart::mapToPosition(const QPointF &value, QAbstractSeries *series)
     return d_ptr->m_dataset->mapToPosition(value, series);
 }
 
+/*!
+  \since 6.0
+  Returns the index of the data point drawn closest to \a position among all the
+  visible line, spline, and scatter series of the chart, or \c -1 if no point is
+  drawn within \a maxDistance pixels of it. The series the point belongs to is
+  stored in \a series, which is set to \c nullptr when no point is found. A
+  negative \a maxDistance does not limit the distance.
+
+  \sa QXYSeries::nearestPointIndex()
+*/
+int QChart::nearestPointIndex(const QPointF &position, QXYSeries **series,
+                              qreal maxDistance) const
+{
+    int nearestIndex = -1;
+    QXYSeries *nearestSeries = nullptr;
+    const QList<QAbstractSeries *> seriesList = d_ptr->m_dataset->series();
+    for (QAbstractSeries *s : seriesList) {
+        if (!s->isVisible())
+            continue;
+        if (s->type() != QAbstractSeries::SeriesTypeLine
+                && s->type() != QAbstractSeries::SeriesTypeSpline
+                && s->type() != QAbstractSeries::SeriesTypeScatter) {
+            continue;
+        }
+        QXYSeries *xySeries = static_cast<QXYSeries *>(s);
+        const int index = xySeries->nearestPointIndex(position, maxDistance);
+        if (index >= 0) {
+            nearestIndex = index;
+            nearestSeries = xySeries;
+            // The series that follow only need to beat the closest point found so far
+            const QPointF delta = d_ptr->m_dataset->mapToPosition(xySeries->at(index), xySeries)
+                    - position;
+            maxDistance = qSqrt(delta.x() * delta.x() + delta.y() * delta.y());
+        }
+    }
+    if (series)
+        *series = nearestSeries;
+    return nearestIndex;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QChartPrivate::QChartPrivate(QChart *q, QChart::ChartType type):
@@ -46,6 +46,7 @@ class QAbstractAxis;
 class QLegend;
 class QChartPrivate;
 class QBoxPlotSeries;
+class QXYSeries;
 
 class Q_CHARTS_EXPORT QChart : public QGraphicsWidget
 {
@@ -58,15 +59,21 @@ class Q_CHARTS_EXPORT QChart : public QGraphicsWidget
     Q_PROPERTY(QChart::AnimationOptions animationOptions READ animationOptions WRITE setAnimationOptions)
     Q_PROPERTY(int animationDuration READ animationDuration WRITE setAnimationDuration)
     Q_PROPERTY(QEasingCurve animationEasingCurve READ animationEasingCurve WRITE setAnimationEasingCurve)
+    Q_PROPERTY(int animationPointLimit READ animationPointLimit WRITE setAnimationPointLimit)
+    Q_PROPERTY(bool plainTextLabels READ plainTextLabels WRITE setPlainTextLabels)
     Q_PROPERTY(QMargins margins READ margins WRITE setMargins)
     Q_PROPERTY(QChart::ChartType chartType READ chartType)
     Q_PROPERTY(bool plotAreaBackgroundVisible READ isPlotAreaBackgroundVisible WRITE setPlotAreaBackgroundVisible)
     Q_PROPERTY(bool localizeNumbers READ localizeNumbers WRITE setLocalizeNumbers)
     Q_PROPERTY(QLocale locale READ locale WRITE setLocale)
     Q_PROPERTY(QRectF plotArea READ plotArea WRITE setPlotArea NOTIFY plotAreaChanged)
+    Q_PROPERTY(bool deferredUpdates READ deferredUpdates WRITE setDeferredUpdates)
+    Q_PROPERTY(int maximumUpdateRate READ maximumUpdateRate WRITE setMaximumUpdateRate)
+    Q_PROPERTY(bool timingEnabled READ isTimingEnabled WRITE setTimingEnabled)
     Q_ENUMS(ChartTheme)
     Q_ENUMS(AnimationOption)
     Q_ENUMS(ChartType)
+    Q_ENUMS(TimingCategory)
 
 public:
     enum ChartType {
@@ -95,6 +102,13 @@ public:
 
     Q_DECLARE_FLAGS(AnimationOptions, AnimationOption)
 
+    enum TimingCategory {
+        LayoutTiming = 0,
+        GeometryTiming,
+        AxisTiming,
+        PaintTiming
+    };
+
 public:
     explicit QChart(QGraphicsItem *parent = nullptr, Qt::WindowFlags wFlags = Qt::WindowFlags());
     ~QChart();
@@ -143,6 +157,11 @@ public:
     int animationDuration() const;
     void setAnimationEasingCurve(const QEasingCurve &curve);
     QEasingCurve animationEasingCurve() const;
+    void setAnimationPointLimit(int limit);
+    int animationPointLimit() const;
+
+    void setPlainTextLabels(bool enabled);
+    bool plainTextLabels() const;
 
     void zoomIn();
     void zoomOut();
@@ -171,14 +190,33 @@ public:
     bool localizeNumbers() const;
     void setLocale(const QLocale &locale);
     QLocale locale() const;
+    void setDeferredUpdates(bool deferred);
+    bool deferredUpdates() const;
+    void setMaximumUpdateRate(int rate);
+    int maximumUpdateRate() const;
+    int updateRequestCount() const;
+    int coalescedUpdateCount() const;
+    int updatePassCount() const;
+    void resetUpdateCounters();
+
+    void setTimingEnabled(bool enabled);
+    bool isTimingEnabled() const;
+    qint64 lastFrameTime(QChart::TimingCategory category) const;
+    qint64 averageFrameTime(QChart::TimingCategory category) const;
+    qint64 maximumFrameTime(QChart::TimingCategory category) const;
+    int timedFrameCount() const;
+    void resetTimings();
 
     QPointF mapToValue(const QPointF &position, QAbstractSeries *series = nullptr);
     QPointF mapToPosition(const QPointF &value, QAbstractSeries *series = nullptr);
+    int nearestPointIndex(const QPointF &position, QXYSeries **series,
+                          qreal maxDistance = -1) const;
 
     ChartType chartType() const;
 
 Q_SIGNALS:
     void plotAreaChanged(const QRectF &plotArea);
+    void timingRecorded(QChart::TimingCategory category, qint64 nsecs);
 
 protected:
     explicit QChart(QChart::ChartType type, QGraphicsItem *parent, Qt::WindowFlags wFlags);
@@ -192,6 +230,7 @@ protected:
     friend class QBoxPlotSeriesPrivate;
     friend class QCandlestickSeriesPrivate;
     friend class AbstractBarChartItem;
+    friend class QChartView;
 
 private:
     Q_DISABLE_COPY(QChart)
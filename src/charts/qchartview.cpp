@@ -30,6 +30,7 @@
 #include <QtCharts/QChartView>
 #include <private/qchartview_p.h>
 #include <private/qchart_p.h>
+#include <private/chartpresenter_p.h>
 #include <QtWidgets/QGraphicsScene>
 #include <QtWidgets/QRubberBand>
 
@@ -281,6 +282,22 @@ void QChartView::resizeEvent(QResizeEvent *event)
     d_ptr->resize();
 }
 
+/*!
+    \since 6.0
+    Paints the chart area specified by \a event. When QChart::timingEnabled is \c true, the time
+    spent in painting is recorded and the timed frame of the chart ends.
+*/
+void QChartView::paintEvent(QPaintEvent *event)
+{
+    ChartPresenter *presenter = d_ptr->m_chart ? d_ptr->m_chart->d_ptr->m_presenter : nullptr;
+    {
+        ChartTimingScope timing(presenter, QChart::PaintTiming);
+        QGraphicsView::paintEvent(event);
+    }
+    if (presenter)
+        presenter->endTimingFrame();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QChartViewPrivate::QChartViewPrivate(QChartView *q, QChart *chart)
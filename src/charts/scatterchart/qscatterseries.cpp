@@ -166,6 +166,25 @@
     The default size is 15.0.
 */
 
+/*!
+    \property QScatterSeries::batchedRendering
+    \brief Whether all the markers are painted at once.
+
+    By default, each marker is a graphics item of its own. When batched
+    rendering is enabled, the series paints all the markers from one
+    pre-rendered marker image instead. Finding the marker under the mouse
+    cursor uses a spatial index. This uses much less memory and is much
+    faster for series with a large number of points.
+
+    The default value is \c false.
+*/
+/*!
+    \qmlproperty bool ScatterSeries::batchedRendering
+    Whether all the markers are painted at once from one pre-rendered marker
+    image instead of using a graphics item for each marker. This is much faster
+    for series with a large number of points. The default value is \c false.
+*/
+
 /*!
     \qmlproperty string ScatterSeries::brushFilename
     The name of the file used as a brush for the series.
@@ -191,6 +210,12 @@
     This signal is emitted when the marker size changes to \a size.
 */
 
+/*!
+    \fn void QScatterSeries::batchedRenderingChanged(bool enabled)
+    This signal is emitted when batched rendering is enabled or disabled, as
+    specified by \a enabled.
+*/
+
 QT_CHARTS_BEGIN_NAMESPACE
 
 /*!
@@ -323,12 +348,29 @@ void QScatterSeries::setMarkerSize(qreal size)
     }
 }
 
+bool QScatterSeries::batchedRendering() const
+{
+    Q_D(const QScatterSeries);
+    return d->m_batchedRendering;
+}
+
+void QScatterSeries::setBatchedRendering(bool enabled)
+{
+    Q_D(QScatterSeries);
+    if (d->m_batchedRendering != enabled) {
+        d->m_batchedRendering = enabled;
+        emit d->updated();
+        emit batchedRenderingChanged(enabled);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QScatterSeriesPrivate::QScatterSeriesPrivate(QScatterSeries *q)
     : QXYSeriesPrivate(q),
       m_shape(QScatterSeries::MarkerShapeCircle),
-      m_size(15.0)
+      m_size(15.0),
+      m_batchedRendering(false)
 {
 }
 
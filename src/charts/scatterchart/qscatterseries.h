@@ -45,6 +45,7 @@ class Q_CHARTS_EXPORT QScatterSeries : public QXYSeries
     Q_PROPERTY(MarkerShape markerShape READ markerShape WRITE setMarkerShape NOTIFY markerShapeChanged)
     Q_PROPERTY(qreal markerSize READ markerSize WRITE setMarkerSize NOTIFY markerSizeChanged)
     Q_PROPERTY(QBrush brush READ brush WRITE setBrush)
+    Q_PROPERTY(bool batchedRendering READ batchedRendering WRITE setBatchedRendering NOTIFY batchedRenderingChanged)
     Q_ENUMS(MarkerShape)
 
 public:
@@ -68,12 +69,15 @@ public:
     void setMarkerShape(MarkerShape shape);
     qreal markerSize() const;
     void setMarkerSize(qreal size);
+    bool batchedRendering() const;
+    void setBatchedRendering(bool enabled);
 
 Q_SIGNALS:
     void colorChanged(QColor color);
     void borderColorChanged(QColor color);
     void markerShapeChanged(MarkerShape shape);
     void markerSizeChanged(qreal size);
+    void batchedRenderingChanged(bool enabled);
 
 private:
     Q_DECLARE_PRIVATE(QScatterSeries)
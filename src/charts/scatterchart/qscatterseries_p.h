@@ -56,6 +56,7 @@ public:
 private:
     QScatterSeries::MarkerShape m_shape;
     qreal m_size;
+    bool m_batchedRendering;
     Q_DECLARE_PUBLIC(QScatterSeries)
 };
 
@@ -37,6 +37,7 @@
 #include <QtWidgets/QGraphicsScene>
 #include <QtCore/QDebug>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
+#include <QtCore/QtMath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -52,7 +53,10 @@ ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
       m_pointLabelsFont(series->pointLabelsFont()),
       m_pointLabelsColor(series->pointLabelsColor()),
       m_pointLabelsClipping(true),
-      m_mousePressed(false)
+      m_mousePressed(false),
+      m_batched(false),
+      m_markerPixmapAntialiased(false),
+      m_markerHovered(false)
 {
     QObject::connect(m_series->d_func(), SIGNAL(updated()), this, SLOT(handleUpdated()));
     QObject::connect(m_series, SIGNAL(visibleChanged()), this, SLOT(handleUpdated()));
@@ -141,6 +145,7 @@ void ScatterChartItem::markerDoubleClicked(QGraphicsItem *marker)
 
 void ScatterChartItem::updateGeometry()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     if (m_series->useOpenGL()) {
         if (m_items.childItems().count())
             deletePoints(m_items.childItems().count());
@@ -155,6 +160,25 @@ void ScatterChartItem::updateGeometry()
 
     const QVector<QPointF>& points = geometryPoints();
 
+    if (m_batched) {
+        // The markers are painted from the geometry points, so only the state used by
+        // paint() and the hit-testing needs refreshing
+        if (m_items.childItems().count())
+            deletePoints(m_items.childItems().count());
+        if (presenter() && presenter()->chartType() == QChart::ChartTypePolar && !points.isEmpty())
+            m_offGridStatus = offGridStatusVector();
+        else
+            m_offGridStatus.clear();
+
+        QRectF clipRect(QPointF(0, 0), domain()->size());
+        if (clipRect.height() <= INT_MAX && clipRect.width() <= INT_MAX) {
+            prepareGeometryChange();
+            m_rect = clipRect;
+        }
+        update();
+        return;
+    }
+
     if (points.size() == 0) {
         deletePoints(m_items.childItems().count());
         return;
@@ -222,6 +246,29 @@ void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     painter->save();
     painter->setClipRect(clipRect);
 
+    if (m_batched) {
+        const qreal devicePixelRatio = painter->device() ? painter->device()->devicePixelRatioF()
+                                                         : qreal(1.0);
+        const bool antialiasing = painter->testRenderHint(QPainter::Antialiasing);
+        if (m_markerPixmap.isNull()
+                || !qFuzzyCompare(m_markerPixmap.devicePixelRatioF(), devicePixelRatio)
+                || m_markerPixmapAntialiased != antialiasing) {
+            updateMarkerPixmap(devicePixelRatio, antialiasing);
+        }
+
+        const QSizeF pixmapSize = QSizeF(m_markerPixmap.size()) / devicePixelRatio;
+        const QPointF offset(pixmapSize.width() / 2, pixmapSize.height() / 2);
+        // Markers centered outside the plot area can still be partly visible
+        const QRectF paintRect = clipRect.adjusted(-offset.x(), -offset.y(),
+                                                   offset.x(), offset.y());
+        const QVector<QPointF> &points = m_points;
+        const bool checkOffGrid = m_offGridStatus.size() == points.size();
+        for (int i = 0; i < points.size(); ++i) {
+            if (paintRect.contains(points.at(i)) && !(checkOffGrid && m_offGridStatus.at(i)))
+                painter->drawPixmap(points.at(i) - offset, m_markerPixmap);
+        }
+    }
+
     if (m_pointLabelsVisible) {
         if (m_pointLabelsClipping)
             painter->setClipping(true);
@@ -257,8 +304,17 @@ void ScatterChartItem::handleUpdated()
         return;
     }
 
+    if (m_batched != m_series->batchedRendering()) {
+        m_batched = m_series->batchedRendering();
+        setAcceptHoverEvents(m_batched);
+        m_markerHovered = false;
+        // Switches between painting the markers and marker items. Creating marker items calls
+        // this function again, which applies the rest of the settings to them.
+        updateGeometry();
+    }
+
     int count = m_items.childItems().count();
-    if (count == 0)
+    if (count == 0 && !m_batched)
         return;
 
     bool recreate = m_visible != m_series->isVisible()
@@ -276,7 +332,10 @@ void ScatterChartItem::handleUpdated()
     bool labelClippingChanged = m_pointLabelsClipping != m_series->pointLabelsClipping();
     m_pointLabelsClipping = m_series->pointLabelsClipping();
 
-    if (recreate) {
+    // Pen, brush, shape or size may have changed
+    m_markerPixmap = QPixmap();
+
+    if (recreate && !m_batched) {
         deletePoints(count);
         createPoints(count);
 
@@ -293,6 +352,116 @@ void ScatterChartItem::handleUpdated()
         update();
 }
 
+// Renders one marker with the pen and brush of the series. In batched rendering, all the markers
+// are drawn from this pixmap.
+void ScatterChartItem::updateMarkerPixmap(qreal devicePixelRatio, bool antialiasing)
+{
+    const QPen pen = m_series->pen();
+    const qreal size = m_series->markerSize();
+    const qreal extent = size + qMax(pen.widthF(), qreal(1.0)) + 2;
+    const int pixels = qCeil(extent * devicePixelRatio);
+
+    QPixmap pixmap(pixels, pixels);
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing, antialiasing);
+    painter.setPen(pen);
+    painter.setBrush(m_series->brush());
+    const qreal margin = (pixels / devicePixelRatio - size) / 2;
+    const QRectF rect(margin, margin, size, size);
+    if (m_shape == QScatterSeries::MarkerShapeCircle)
+        painter.drawEllipse(rect);
+    else
+        painter.drawRect(rect);
+    painter.end();
+
+    m_markerPixmap = pixmap;
+    m_markerPixmapAntialiased = antialiasing;
+}
+
+// Returns the index of the geometry point whose marker contains the position, or -1
+int ScatterChartItem::markerAt(const QPointF &position)
+{
+    const qreal radius = m_series->markerSize() / 2;
+    int index;
+    if (m_shape == QScatterSeries::MarkerShapeCircle)
+        index = nearestGeometryPoint(position, radius, XYPointIndex::EuclideanMetric);
+    else
+        index = nearestGeometryPoint(position, radius, XYPointIndex::ChebyshevMetric);
+
+    if (index >= 0 && m_offGridStatus.size() == m_points.size() && m_offGridStatus.at(index))
+        return -1;
+    return index;
+}
+
+QPointF ScatterChartItem::seriesPoint(int index) const
+{
+    // See updateGeometry() for why the index is limited
+    if (m_series->count() == 0)
+        return QPointF();
+    return m_series->at(qMin(m_series->count() - 1, index));
+}
+
+void ScatterChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    const int index = m_batched ? markerAt(event->pos()) : -1;
+    const bool hovered = index >= 0;
+    const QPointF point = hovered ? seriesPoint(index) : QPointF();
+    if (m_markerHovered && (!hovered || point != m_hoveredPoint))
+        emit XYChart::hovered(m_hoveredPoint, false);
+    if (hovered && (!m_markerHovered || point != m_hoveredPoint))
+        emit XYChart::hovered(point, true);
+    m_markerHovered = hovered;
+    m_hoveredPoint = point;
+    XYChart::hoverMoveEvent(event);
+}
+
+void ScatterChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    if (m_markerHovered) {
+        m_markerHovered = false;
+        emit XYChart::hovered(m_hoveredPoint, false);
+    }
+    XYChart::hoverLeaveEvent(event);
+}
+
+void ScatterChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = m_batched ? markerAt(event->pos()) : -1;
+    if (index < 0) {
+        // Let the press through to the chart, like the area between marker items does
+        XYChart::mousePressEvent(event);
+        return;
+    }
+    m_pressedPoint = seriesPoint(index);
+    m_mousePressed = true;
+    emit XYChart::pressed(m_pressedPoint);
+}
+
+void ScatterChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    if (!m_batched) {
+        XYChart::mouseReleaseEvent(event);
+        return;
+    }
+    emit XYChart::released(m_pressedPoint);
+    if (m_mousePressed)
+        emit XYChart::clicked(m_pressedPoint);
+    m_mousePressed = false;
+}
+
+void ScatterChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = m_batched ? markerAt(event->pos()) : -1;
+    if (index < 0) {
+        XYChart::mouseDoubleClickEvent(event);
+        return;
+    }
+    emit XYChart::doubleClicked(seriesPoint(index));
+}
+
 QT_CHARTS_END_NAMESPACE
 
 #include "moc_scatterchartitem_p.cpp"
@@ -44,6 +44,7 @@
 #include <QtWidgets/QGraphicsEllipseItem>
 #include <QtGui/QPen>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
+#include <QtGui/QPixmap>
 #include <QtCharts/private/qchartglobal_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -81,9 +82,17 @@ public Q_SLOTS:
 private:
     void createPoints(int count);
     void deletePoints(int count);
+    void updateMarkerPixmap(qreal devicePixelRatio, bool antialiasing);
+    int markerAt(const QPointF &position);
+    QPointF seriesPoint(int index) const;
 
 protected:
     void updateGeometry();
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
 
 private:
     QScatterSeries *m_series;
@@ -101,6 +110,15 @@ private:
     bool m_pointLabelsClipping;
 
     bool m_mousePressed;
+
+    // Batched rendering paints all the markers from m_markerPixmap instead of using marker items
+    bool m_batched;
+    QPixmap m_markerPixmap;
+    bool m_markerPixmapAntialiased;
+    QVector<bool> m_offGridStatus;
+    bool m_markerHovered;
+    QPointF m_hoveredPoint;
+    QPointF m_pressedPoint;
 };
 
 class Q_CHARTS_PRIVATE_EXPORT CircleMarker: public QGraphicsEllipseItem
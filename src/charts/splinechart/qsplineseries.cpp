@@ -106,6 +106,55 @@
     The number of data points in the series.
 */
 
+/*!
+    \enum QSplineSeries::SplineType
+    \since 6.0
+
+    This enum describes how the curve through the data points is calculated.
+
+    \value NaturalSpline
+           A smooth curve whose shape depends on all the data points of the series. Any
+           change to the data or to the visible range calculates the whole curve again.
+    \value CatmullRomSpline
+           A Catmull-Rom spline, where each segment depends only on its two neighbouring
+           data points.
+    \value MonotoneSpline
+           A monotone cubic spline, which does not overshoot the data: the curve between two
+           data points stays within their value range. Each segment depends only on its two
+           neighbouring data points.
+*/
+
+/*!
+    \property QSplineSeries::splineType
+    \brief The method used to calculate the curve through the data points.
+    \since 6.0
+
+    With QSplineSeries::CatmullRomSpline and QSplineSeries::MonotoneSpline, each segment of the
+    curve depends only on the nearby data points. If the x values of the series are in
+    ascending order, only the segments within the visible x-range are calculated, and
+    appending data points only calculates the new segments. This makes them better suited for
+    large and streaming series than the default QSplineSeries::NaturalSpline.
+*/
+/*!
+    \qmlproperty enumeration SplineSeries::splineType
+    \since QtCharts 2.15
+    The method used to calculate the curve through the data points.
+
+    \value SplineSeries.NaturalSpline
+           A smooth curve whose shape depends on all the data points. This is the default value.
+    \value SplineSeries.CatmullRomSpline
+           A Catmull-Rom spline, where each segment depends only on the nearby data points.
+    \value SplineSeries.MonotoneSpline
+           A monotone cubic spline, which does not overshoot the data.
+
+    \sa QSplineSeries::splineType
+*/
+/*!
+    \fn void QSplineSeries::splineTypeChanged(QSplineSeries::SplineType type)
+    \since 6.0
+    This signal is emitted when the spline type changes to \a type.
+*/
+
 QT_CHARTS_BEGIN_NAMESPACE
 
 /*!
@@ -137,10 +186,26 @@ QAbstractSeries::SeriesType QSplineSeries::type() const
     return QAbstractSeries::SeriesTypeSpline;
 }
 
+void QSplineSeries::setSplineType(QSplineSeries::SplineType type)
+{
+    Q_D(QSplineSeries);
+    if (d->m_splineType != type) {
+        d->m_splineType = type;
+        emit splineTypeChanged(type);
+    }
+}
+
+QSplineSeries::SplineType QSplineSeries::splineType() const
+{
+    Q_D(const QSplineSeries);
+    return d->m_splineType;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QSplineSeriesPrivate::QSplineSeriesPrivate(QSplineSeries *q)
-    : QLineSeriesPrivate(q)
+    : QLineSeriesPrivate(q),
+      m_splineType(QSplineSeries::NaturalSpline)
 {
 }
 
@@ -43,12 +43,27 @@ class QSplineSeriesPrivate;
 class Q_CHARTS_EXPORT QSplineSeries : public QLineSeries
 {
     Q_OBJECT
+    Q_PROPERTY(SplineType splineType READ splineType WRITE setSplineType NOTIFY splineTypeChanged)
+    Q_ENUMS(SplineType)
+
+public:
+    enum SplineType {
+        NaturalSpline = 0,
+        CatmullRomSpline,
+        MonotoneSpline
+    };
 
 public:
     explicit QSplineSeries(QObject *parent = nullptr);
     ~QSplineSeries();
     QAbstractSeries::SeriesType type() const;
 
+    void setSplineType(SplineType type);
+    SplineType splineType() const;
+
+Q_SIGNALS:
+    void splineTypeChanged(QSplineSeries::SplineType type);
+
 private:
     Q_DECLARE_PRIVATE(QSplineSeries)
     Q_DISABLE_COPY(QSplineSeries)
@@ -56,6 +56,9 @@ public:
     void initializeAnimations(QtCharts::QChart::AnimationOptions options, int duration,
                               QEasingCurve &curve);
 
+protected:
+    QSplineSeries::SplineType m_splineType;
+
 private:
     Q_DECLARE_PUBLIC(QSplineSeries)
 };
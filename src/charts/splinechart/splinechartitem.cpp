@@ -33,6 +33,7 @@
 #include <private/splineanimation_p.h>
 #include <private/polardomain_p.h>
 #include <QtGui/QPainter>
+#include <QtCore/QtMath>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -40,6 +41,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 SplineChartItem::SplineChartItem(QSplineSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
+      m_fullPathDirty(false),
       m_pointsVisible(false),
       m_animation(0),
       m_pointLabelsVisible(false),
@@ -62,6 +64,8 @@ SplineChartItem::SplineChartItem(QSplineSeries *series, QGraphicsItem *item)
     QObject::connect(series, SIGNAL(pointLabelsFontChanged(QFont)), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(pointLabelsColorChanged(QColor)), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(pointLabelsClippingChanged(bool)), this, SLOT(handleUpdated()));
+    QObject::connect(series, &QSplineSeries::splineTypeChanged,
+                     this, &XYChart::handleDomainUpdated);
     handleUpdated();
 }
 
@@ -72,6 +76,10 @@ QRectF SplineChartItem::boundingRect() const
 
 QPainterPath SplineChartItem::shape() const
 {
+    if (m_fullPathDirty) {
+        m_fullPath = strokeShape(m_path);
+        m_fullPathDirty = false;
+    }
     return m_fullPath;
 }
 
@@ -99,17 +107,28 @@ QVector<QPointF> SplineChartItem::controlGeometryPoints() const
 void SplineChartItem::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index)
 {
     QVector<QPointF> controlPoints;
-    if (newPoints.count() >= 2)
-        controlPoints = calculateControlPoints(newPoints);
+    if (newPoints.count() >= 2) {
+        if (m_series->splineType() == QSplineSeries::NaturalSpline)
+            controlPoints = calculateControlPoints(newPoints);
+        else
+            calculateLocalControlPoints(newPoints, controlPoints, 0);
+    }
 
-    if (m_animation)
+    const bool animate = animationEnabled();
+    if (animate) {
         m_animation->setup(oldPoints, newPoints, m_controlPoints, controlPoints, index);
+    } else if (m_animation && m_animation->state() != QAbstractAnimation::Stopped) {
+        // Stopping may still set the geometry points, which newPoints can refer to
+        QVector<QPointF> points = newPoints;
+        m_animation->stop();
+        newPoints = points;
+    }
 
     m_points = newPoints;
     m_controlPoints = controlPoints;
     setDirty(false);
 
-    if (m_animation)
+    if (animate)
         presenter()->startAnimation(m_animation);
     else
         updateGeometry();
@@ -117,12 +136,15 @@ void SplineChartItem::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF>
 
 void SplineChartItem::updateGeometry()
 {
+    ChartTimingScope timing(presenter(), QChart::GeometryTiming);
     const QVector<QPointF> &points = m_points;
     const QVector<QPointF> &controlPoints = m_controlPoints;
 
     if ((points.size() < 2) || (controlPoints.size() < 2)) {
         prepareGeometryChange();
         m_path = QPainterPath();
+        m_fullPath = QPainterPath();
+        m_fullPathDirty = false;
         m_rect = QRect();
         return;
     }
@@ -291,18 +313,9 @@ void SplineChartItem::updateGeometry()
         fullPath = splinePath;
     }
 
-    QPainterPathStroker stroker;
-    // The full path is comprised of three separate paths.
-    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
-    // multiply line width with square root of two when defining shape and bounding rectangle.
-    stroker.setWidth(margin);
-    stroker.setJoinStyle(Qt::MiterJoin);
-    stroker.setCapStyle(Qt::SquareCap);
-    stroker.setMiterLimit(m_linePen.miterLimit());
-
     // Only zoom in if the bounding rects of the path fit inside int limits. QWidget::update() uses
     // a region that has to be compatible with QRect.
-    QPainterPath checkShapePath = stroker.createStroke(fullPath);
+    QPainterPath checkShapePath = strokeShape(fullPath);
     if (checkShapePath.boundingRect().height() <= INT_MAX
             && checkShapePath.boundingRect().width() <= INT_MAX
             && splinePath.boundingRect().height() <= INT_MAX
@@ -312,10 +325,79 @@ void SplineChartItem::updateGeometry()
         prepareGeometryChange();
 
         m_fullPath = checkShapePath;
+        m_fullPathDirty = false;
         m_rect = m_fullPath.boundingRect();
     }
 }
 
+void SplineChartItem::updateGeometryAppended(int index, int count)
+{
+    // Appending points to a local spline changes only the segments next to them, so a plain
+    // spline path can be extended. The geometry may be out of sync if an update was skipped.
+    if (m_series->splineType() == QSplineSeries::NaturalSpline
+            || m_series->chart()->chartType() == QChart::ChartTypePolar
+            || index < 2 || m_points.size() != index + count
+            || m_controlPoints.size() != 2 * index - 2
+            || m_path.elementCount() != 3 * index - 2) {
+        XYChart::updateGeometryAppended(index, count);
+        return;
+    }
+
+    // The segment ending at the former last point changes with the tangent at that point
+    const int firstSegment = index - 2;
+    calculateLocalControlPoints(m_points, m_controlPoints, firstSegment);
+
+    // The segments lie within the polygon of their points and control points
+    QRectF segmentRect = QPolygonF(m_points.mid(firstSegment)).boundingRect()
+            | QPolygonF(m_controlPoints.mid(2 * firstSegment)).boundingRect();
+    const qreal margin = m_linePen.width() * 1.42;
+    const qreal extent = margin * qMax(m_linePen.miterLimit(), qreal(M_SQRT2)) / 2 + 1;
+    segmentRect.adjust(-extent, -extent, extent, extent);
+    const QRectF rect = m_rect.united(segmentRect);
+    if (rect.width() > INT_MAX || rect.height() > INT_MAX) {
+        updateGeometry();
+        return;
+    }
+
+    if (rect != m_rect)
+        prepareGeometryChange();
+    else
+        update(segmentRect);
+
+    // Each segment is stored as three path elements following the initial move
+    const QPointF &control = m_controlPoints.at(2 * firstSegment + 1);
+    m_path.setElementPositionAt(3 * firstSegment + 2, control.x(), control.y());
+    for (int i = index - 1; i < m_points.size() - 1; i++)
+        m_path.cubicTo(m_controlPoints.at(2 * i), m_controlPoints.at(2 * i + 1), m_points.at(i + 1));
+    m_fullPathDirty = true;
+    m_rect = rect;
+}
+
+// Returns true if only the visible part of the series needs to be mapped to geometry, see
+// XYChart::cullingEnabled(). The control points of a natural spline depend on all the points
+// of the series, so only local splines can be culled.
+bool SplineChartItem::cullingEnabled() const
+{
+    if (m_series->splineType() == QSplineSeries::NaturalSpline)
+        return false;
+    if (m_series->pointLabelsVisible() || animationEnabled())
+        return false;
+    return presenter() && presenter()->chartType() != QChart::ChartTypePolar;
+}
+
+QPainterPath SplineChartItem::strokeShape(const QPainterPath &path) const
+{
+    QPainterPathStroker stroker;
+    // The full path is comprised of three separate paths.
+    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
+    // multiply line width with square root of two when defining shape and bounding rectangle.
+    stroker.setWidth(m_linePen.width() * 1.42);
+    stroker.setJoinStyle(Qt::MiterJoin);
+    stroker.setCapStyle(Qt::SquareCap);
+    stroker.setMiterLimit(m_linePen.miterLimit());
+    return stroker.createStroke(path);
+}
+
 /*!
   Calculates control points which are needed by QPainterPath.cubicTo function to draw the cubic Bezier cureve between two points.
   */
@@ -387,6 +469,71 @@ QVector<QPointF> SplineChartItem::calculateControlPoints(const QVector<QPointF>
     return controlPoints;
 }
 
+// Returns the tangent of a Catmull-Rom spline at points[k]. The end points use their only
+// neighbour.
+static QPointF catmullRomTangent(const QVector<QPointF> &points, int k)
+{
+    const QPointF &previous = points.at(qMax(0, k - 1));
+    const QPointF &next = points.at(qMin(int(points.size()) - 1, k + 1));
+    return (next - previous) / 2;
+}
+
+// Returns the slope of a monotone cubic spline at points[k]. Where the data changes direction
+// the slope is zero, elsewhere it is the weighted harmonic mean of the neighbouring secants
+// (Fritsch-Butland), which keeps the curve between two points within their value range.
+static qreal monotoneSlope(const QVector<QPointF> &points, int k)
+{
+    const int last = points.size() - 1;
+    const QPointF &previous = points.at(qMax(0, k - 1));
+    const QPointF &current = points.at(k);
+    const QPointF &next = points.at(qMin(last, k + 1));
+    const qreal h0 = current.x() - previous.x();
+    const qreal h1 = next.x() - current.x();
+    if (k == 0 || k == last) {
+        const qreal h = h0 + h1;
+        return h != 0 ? (next.y() - previous.y()) / h : 0;
+    }
+    if (h0 == 0 || h1 == 0)
+        return 0;
+    const qreal d0 = (current.y() - previous.y()) / h0;
+    const qreal d1 = (next.y() - current.y()) / h1;
+    if (d0 * d1 <= 0)
+        return 0;
+    return 3 * (h0 + h1) / ((2 * h1 + h0) / d0 + (h1 + 2 * h0) / d1);
+}
+
+/*!
+  Calculates the control points of a Catmull-Rom or monotone spline for the segments from
+  \a firstSegment on. Each segment depends only on the two points before and after it, so the
+  control points of the earlier segments in \a controlPoints are kept.
+  */
+void SplineChartItem::calculateLocalControlPoints(const QVector<QPointF> &points,
+                                                  QVector<QPointF> &controlPoints,
+                                                  int firstSegment)
+{
+    const int segmentCount = points.size() - 1;
+    controlPoints.resize(2 * segmentCount);
+
+    if (m_series->splineType() == QSplineSeries::CatmullRomSpline) {
+        QPointF tangent = catmullRomTangent(points, firstSegment);
+        for (int i = firstSegment; i < segmentCount; i++) {
+            const QPointF nextTangent = catmullRomTangent(points, i + 1);
+            controlPoints[2 * i] = points.at(i) + tangent / 3;
+            controlPoints[2 * i + 1] = points.at(i + 1) - nextTangent / 3;
+            tangent = nextTangent;
+        }
+    } else {
+        qreal slope = monotoneSlope(points, firstSegment);
+        for (int i = firstSegment; i < segmentCount; i++) {
+            const qreal nextSlope = monotoneSlope(points, i + 1);
+            const qreal step = (points.at(i + 1).x() - points.at(i).x()) / 3;
+            controlPoints[2 * i] = points.at(i) + QPointF(step, slope * step);
+            controlPoints[2 * i + 1] = points.at(i + 1) - QPointF(step, nextSlope * step);
+            slope = nextSlope;
+        }
+    }
+}
+
 QVector<qreal> SplineChartItem::firstControlPoints(const QVector<qreal>& vector)
 {
     QVector<qreal> result;
@@ -60,6 +60,7 @@ public:
     QPainterPath shape() const;
 
     void setControlGeometryPoints(QVector<QPointF>& points);
+    void swapControlGeometryPoints(QVector<QPointF> &points) { m_controlPoints.swap(points); }
     QVector<QPointF> controlGeometryPoints() const;
 
     void setAnimation(SplineAnimation *animation);
@@ -72,7 +73,11 @@ protected:
     void updateGeometry();
     QVector<QPointF> calculateControlPoints(const QVector<QPointF> &points);
     QVector<qreal> firstControlPoints(const QVector<qreal>& vector);
+    void calculateLocalControlPoints(const QVector<QPointF> &points,
+                                     QVector<QPointF> &controlPoints, int firstSegment);
     void updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index);
+    void updateGeometryAppended(int index, int count);
+    bool cullingEnabled() const;
     void mousePressEvent(QGraphicsSceneMouseEvent *event);
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
     void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
@@ -80,11 +85,15 @@ protected:
     void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
 
 private:
+    QPainterPath strokeShape(const QPainterPath &path) const;
+
     QSplineSeries *m_series;
     QPainterPath m_path;
     QPainterPath m_pathPolarRight;
     QPainterPath m_pathPolarLeft;
-    QPainterPath m_fullPath;
+    mutable QPainterPath m_fullPath;
+    // Set when m_fullPath has to be stroked from m_path again before it is used
+    mutable bool m_fullPathDirty;
     QRectF m_rect;
     QPen m_linePen;
     QPen m_pointPen;
@@ -29,10 +29,24 @@
 
 #include "private/glxyseriesdata_p.h"
 #include "private/abstractdomain_p.h"
+#include "private/qxyseries_p.h"
 #include <QtCharts/QScatterSeries>
+#include <QtCharts/QXYDataSource>
+#ifndef QT_NO_OPENGL
+#  include <QtGui/QOpenGLBuffer>
+#endif
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+static bool hasLogAxis(QXYSeries *series)
+{
+    foreach (QAbstractAxis* axis, series->attachedAxes()) {
+        if (axis->type() == QAbstractAxis::AxisTypeLogValue)
+            return true;
+    }
+    return false;
+}
+
 GLXYSeriesDataManager::GLXYSeriesDataManager(QObject *parent)
     : QObject(parent),
       m_mapDirty(false)
@@ -71,35 +85,20 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
                 &GLXYSeriesDataManager::handleSeriesOpenGLChange);
         connect(series, &QXYSeries::visibleChanged, this,
                 &GLXYSeriesDataManager::handleSeriesVisibilityChange);
+        data->dirtyStart = data->dirtyEnd = 0;
         m_seriesDataMap.insert(series, data);
         m_mapDirty = true;
     }
     QVector<float> &array = data->array;
 
-    bool logAxis = false;
-    bool reverseX = false;
-    bool reverseY = false;
-    foreach (QAbstractAxis* axis, series->attachedAxes()) {
-        if (axis->type() == QAbstractAxis::AxisTypeLogValue) {
-            logAxis = true;
-            break;
-        }
-        if (axis->isReverse()) {
-            if (axis->orientation() == Qt::Horizontal)
-                reverseX = true;
-            else
-                reverseY = true;
-            if (reverseX && reverseY)
-                break;
-        }
-    }
-    int count = series->count();
+    const int count = series->count();
     int index = 0;
     array.resize(count * 2);
-    QMatrix4x4 matrix;
-    if (logAxis) {
+    data->logAxis = hasLogAxis(series);
+    if (data->logAxis) {
         // Use domain to resolve geometry points. Not as fast as shaders, but simpler that way
-        QVector<QPointF> geometryPoints = domain->calculateGeometryPoints(series->pointsVector());
+        QVector<QPointF> geometryPoints =
+                domain->calculateGeometryPoints(series->d_func()->pointsRange(0, count));
         const float height = domain->size().height();
         if (geometryPoints.size()) {
             for (int i = 0; i < count; i++) {
@@ -114,34 +113,168 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
                 array[index++] = 0.0f;
             }
         }
-        data->min = QVector2D(0, 0);
-        data->delta = QVector2D(domain->size().width() / 2.0f, domain->size().height() / 2.0f);
     } else {
-        // Regular value axes, so we can optimize it a bit.
-        if (reverseX)
-            matrix.scale(-1.0, 1.0);
-        if (reverseY)
-            matrix.scale(1.0, -1.0);
-
-        const qreal mx = domain->minX();
-        const qreal my = domain->minY();
-        const qreal xd = domain->maxX() - mx;
-        const qreal yd = domain->maxY() - my;
-
-        if (!qFuzzyIsNull(xd) && !qFuzzyIsNull(yd)) {
-            const QVector<QPointF> seriesPoints = series->pointsVector();
+        // Regular value axes, so the points are stored as they are and mapped to the plot area
+        // by the shader. They are stored relative to the first point, as the float precision
+        // would not suffice for large values that are close to each other, such as timestamps.
+        const QXYDataSource *source = series->dataSource();
+        data->origin = count ? series->d_func()->pointAt(0) : QPointF();
+        const qreal ox = data->origin.x();
+        const qreal oy = data->origin.y();
+        if (source) {
+            // Read the points in blocks instead of copying all of them
+            const int blockSize = 4096;
+            QVector<QPointF> block(qMin(blockSize, count));
+            for (int start = 0; start < count; start += blockSize) {
+                const int size = qMin(blockSize, count - start);
+                source->readPoints(start, size, block.data());
+                for (int i = 0; i < size; i++) {
+                    array[index++] = float(block.at(i).x() - ox);
+                    array[index++] = float(block.at(i).y() - oy);
+                }
+            }
+        } else {
+            const QVector<QPointF> seriesPoints = series->d_func()->pointsRange(0, count);
             for (const QPointF &point : seriesPoints) {
-                array[index++] = float((point.x() - mx) / xd);
-                array[index++] = float((point.y() - my) / yd);
+                array[index++] = float(point.x() - ox);
+                array[index++] = float(point.y() - oy);
             }
         }
-        data->min = QVector2D(0.0f, 0.0f);
-        data->delta = QVector2D(0.5f, 0.5f);
     }
-    data->matrix = matrix;
+    data->start = 0;
+    data->pointCount = count;
+    updateTransform(data, series, domain);
+    data->arrayDirty = true;
+    data->dirtyStart = data->dirtyEnd = 0;
     data->dirty = true;
 }
 
+// Updates the series after count points have been appended or replaced at index. Only those
+// points are stored, and only they are uploaded on the next render. Other changes, and series
+// with logarithmic axes, set all the points again.
+void GLXYSeriesDataManager::updatePoints(QXYSeries *series, const AbstractDomain *domain,
+                                         int index, int count)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    const int seriesCount = series->count();
+    const bool appended = data && index == data->pointCount && seriesCount == index + count;
+    const bool replaced = data && seriesCount == data->pointCount && index + count <= seriesCount;
+    if (!data || data->logAxis || data->pointCount == 0 || !(appended || replaced)) {
+        setPoints(series, domain);
+        return;
+    }
+
+    // The vector grows its capacity geometrically, so appending does not copy it every time
+    QVector<float> &array = data->array;
+    const int start = data->start;
+    array.resize((start + seriesCount) * 2);
+    const qreal ox = data->origin.x();
+    const qreal oy = data->origin.y();
+    for (int i = index; i < index + count; i++) {
+        const QPointF point = series->d_func()->pointAt(i);
+        array[2 * (start + i)] = float(point.x() - ox);
+        array[2 * (start + i) + 1] = float(point.y() - oy);
+    }
+    data->pointCount = seriesCount;
+    if (data->dirtyStart < data->dirtyEnd) {
+        data->dirtyStart = qMin(data->dirtyStart, start + index);
+        data->dirtyEnd = qMax(data->dirtyEnd, start + index + count);
+    } else {
+        data->dirtyStart = start + index;
+        data->dirtyEnd = start + index + count;
+    }
+    data->dirty = true;
+}
+
+// Updates the series after its removed oldest points have made room for count points appended
+// to it. The kept points stay where they are in the vertex array and are drawn from the new
+// start vertex, so only the appended points are stored and uploaded. Once the array holds as
+// many shifted out points as kept ones, the points are set again, which also moves the origin
+// along with the data.
+void GLXYSeriesDataManager::shiftPoints(QXYSeries *series, const AbstractDomain *domain,
+                                        int removed, int count)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->logAxis || removed > data->pointCount
+            || data->start + removed >= series->count()) {
+        setPoints(series, domain);
+        return;
+    }
+    data->start += removed;
+    data->pointCount -= removed;
+    updatePoints(series, domain, data->pointCount, count);
+}
+
+#ifndef QT_NO_OPENGL
+// Uploads the changed points of the series to the bound buffer, or all of them if all is set.
+// The buffer grows geometrically as points are appended, so that usually only the appended
+// points are written.
+void GLXYSeriesDataManager::uploadPoints(QOpenGLBuffer *buffer, const GLXYSeriesData *data,
+                                         bool all)
+{
+    const int pointSize = 2 * sizeof(float);
+    const int size = (data->start + data->pointCount) * pointSize;
+    if (size > buffer->size()) {
+        buffer->allocate(all ? size : qMax(size, 2 * buffer->size()));
+        all = true;
+    }
+    if (all)
+        buffer->write(0, data->array.constData(), size);
+    else if (data->dirtyStart < data->dirtyEnd)
+        buffer->write(data->dirtyStart * pointSize, data->array.constData() + 2 * data->dirtyStart,
+                      (data->dirtyEnd - data->dirtyStart) * pointSize);
+}
+#endif
+
+// Updates the series for a changed domain. With value axes only the transformation of the
+// points changes, so the vertex array does not need to be uploaded again.
+void GLXYSeriesDataManager::setDomain(QXYSeries *series, const AbstractDomain *domain)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->logAxis || hasLogAxis(series)) {
+        setPoints(series, domain);
+        return;
+    }
+    updateTransform(data, series, domain);
+    data->dirty = true;
+}
+
+void GLXYSeriesDataManager::updateTransform(GLXYSeriesData *data, QXYSeries *series,
+                                            const AbstractDomain *domain)
+{
+    if (data->logAxis) {
+        data->min = QVector2D(0, 0);
+        data->delta = QVector2D(domain->size().width() / 2.0f, domain->size().height() / 2.0f);
+        data->matrix = QMatrix4x4();
+        return;
+    }
+
+    bool reverseX = false;
+    bool reverseY = false;
+    foreach (QAbstractAxis* axis, series->attachedAxes()) {
+        if (axis->isReverse()) {
+            if (axis->orientation() == Qt::Horizontal)
+                reverseX = true;
+            else
+                reverseY = true;
+        }
+    }
+    QMatrix4x4 matrix;
+    if (reverseX)
+        matrix.scale(-1.0, 1.0);
+    if (reverseY)
+        matrix.scale(1.0, -1.0);
+    data->matrix = matrix;
+
+    const qreal xd = domain->maxX() - domain->minX();
+    const qreal yd = domain->maxY() - domain->minY();
+    data->min = QVector2D(float(domain->minX() - data->origin.x()),
+                          float(domain->minY() - data->origin.y()));
+    // An empty range would divide by zero in the shader
+    data->delta = QVector2D(qFuzzyIsNull(xd) ? 1.0f : float(xd / 2.0),
+                            qFuzzyIsNull(yd) ? 1.0f : float(yd / 2.0));
+}
+
 void GLXYSeriesDataManager::removeSeries(const QXYSeries *series)
 {
     GLXYSeriesData *data = m_seriesDataMap.take(series);
@@ -47,16 +47,32 @@
 #include <QtGui/QVector2D>
 #include <QtGui/QMatrix4x4>
 
+QT_FORWARD_DECLARE_CLASS(QOpenGLBuffer)
+
 QT_CHARTS_BEGIN_NAMESPACE
 
 class AbstractDomain;
 
+// The vertex array holds the points relative to origin, or the geometry points if the series
+// has a logarithmic axis. Changing the visible range of a series with value axes only changes
+// min, delta, and matrix, which the shader uses to map the points to the plot area. dirty is set
+// when anything needs to be drawn again, arrayDirty when the whole array needs to be uploaded
+// again, and the points from dirtyStart to dirtyEnd when only they have been appended or replaced.
+// The points of the series start at vertex start of the array, the vertices before it belong to
+// points that have been shifted out of a full series.
 struct GLXYSeriesData {
     QVector<float> array;
+    int start;
+    int pointCount;
     bool dirty;
+    bool arrayDirty;
+    int dirtyStart;
+    int dirtyEnd;
     QVector3D color;
     float width;
     QAbstractSeries::SeriesType type;
+    QPointF origin;
+    bool logAxis;
     QVector2D min;
     QVector2D delta;
     bool visible;
@@ -64,10 +80,17 @@ struct GLXYSeriesData {
 public:
     GLXYSeriesData &operator=(const GLXYSeriesData &data) {
         array = data.array;
+        start = data.start;
+        pointCount = data.pointCount;
         dirty = data.dirty;
+        arrayDirty = data.arrayDirty;
+        dirtyStart = data.dirtyStart;
+        dirtyEnd = data.dirtyEnd;
         color = data.color;
         width = data.width;
         type = data.type;
+        origin = data.origin;
+        logAxis = data.logAxis;
         min = data.min;
         delta = data.delta;
         visible = data.visible;
@@ -87,6 +110,12 @@ public:
     ~GLXYSeriesDataManager();
 
     void setPoints(QXYSeries *series, const AbstractDomain *domain);
+    void setDomain(QXYSeries *series, const AbstractDomain *domain);
+    void updatePoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
+    void shiftPoints(QXYSeries *series, const AbstractDomain *domain, int removed, int count);
+#ifndef QT_NO_OPENGL
+    static void uploadPoints(QOpenGLBuffer *buffer, const GLXYSeriesData *data, bool all);
+#endif
 
     void removeSeries(const QXYSeries *series);
 
@@ -96,8 +125,11 @@ public:
     bool mapDirty() const { return m_mapDirty; }
     void clearAllDirty() {
         m_mapDirty = false;
-        foreach (GLXYSeriesData *data, m_seriesDataMap.values())
+        foreach (GLXYSeriesData *data, m_seriesDataMap.values()) {
             data->dirty = false;
+            data->arrayDirty = false;
+            data->dirtyStart = data->dirtyEnd = 0;
+        }
     }
     void handleAxisReverseChanged(const QList<QAbstractSeries *> &seriesList);
 
@@ -113,6 +145,9 @@ Q_SIGNALS:
     void seriesRemoved(const QXYSeries *series);
 
 private:
+    static void updateTransform(GLXYSeriesData *data, QXYSeries *series,
+                                const AbstractDomain *domain);
+
     GLXYDataMap m_seriesDataMap;
     bool m_mapDirty;
 };
@@ -0,0 +1,661 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QXYDataSource>
+#include <private/qxydatasource_p.h>
+#include <QtCore/QtEndian>
+#include <limits>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QXYDataSource
+    \inmodule QtCharts
+    \brief The QXYDataSource class is an interface for providing the data points of an
+    XY series from storage owned by the application.
+    \since 6.0
+
+    By default, a QXYSeries keeps a copy of its data points. When the data already lives in
+    a buffer of the application, such as a memory-mapped file, the series can read the data
+    points from a QXYDataSource set with QXYSeries::setDataSource() instead, so that the data
+    is not stored twice.
+
+    Subclasses reimplement count() and at(), and readPoints() if consecutive points can be
+    read faster than one by one. The data source is read-only for the series. When the data
+    changes, the data source must emit pointsAdded(), pointsRemoved(), pointsChanged(),
+    or reset() after the change, so that the series and the chart are updated. Only the
+    changed range is mapped again when the series allows it.
+
+    QXYArrayDataSource provides the data points from arrays of x and y values.
+
+    \sa QXYSeries::setDataSource(), QXYArrayDataSource
+*/
+
+/*!
+    \fn int QXYDataSource::count() const
+
+    Returns the number of data points.
+*/
+
+/*!
+    \fn QPointF QXYDataSource::at(int index) const
+
+    Returns the data point at the position specified by \a index.
+*/
+
+/*!
+    \fn void QXYDataSource::pointsAdded(int index, int count)
+
+    This signal must be emitted after \a count data points were added starting at the
+    position specified by \a index.
+*/
+
+/*!
+    \fn void QXYDataSource::pointsRemoved(int index, int count)
+
+    This signal must be emitted after \a count data points were removed starting at the
+    position specified by \a index.
+*/
+
+/*!
+    \fn void QXYDataSource::pointsChanged(int index, int count)
+
+    This signal must be emitted after the values of \a count data points starting at the
+    position specified by \a index were changed.
+*/
+
+/*!
+    \fn void QXYDataSource::reset()
+
+    This signal must be emitted after the data points were changed in a way that is not
+    described by the other signals, such as when the data was replaced.
+*/
+
+/*!
+    Constructs a data source with the parent \a parent.
+*/
+QXYDataSource::QXYDataSource(QObject *parent)
+    : QObject(parent)
+{
+}
+
+/*!
+    Destroys the data source. Series using it become empty.
+*/
+QXYDataSource::~QXYDataSource()
+{
+}
+
+/*!
+    Copies \a count data points starting at the position specified by \a index to
+    \a points, which must have room for them. The default implementation calls at()
+    for each point.
+*/
+void QXYDataSource::readPoints(int index, int count, QPointF *points) const
+{
+    for (int i = 0; i < count; i++)
+        points[i] = at(index + i);
+}
+
+/*!
+    \class QXYArrayDataSource
+    \inmodule QtCharts
+    \brief The QXYArrayDataSource class provides the data points of an XY series from
+    arrays of x and y values.
+    \since 6.0
+
+    The x and y values are read from arrays of \c double values owned by the application,
+    which can be separate arrays or a single array of interleaved x and y values. The arrays
+    are not copied and must remain valid as long as the data source uses them.
+
+    For example, a buffer of interleaved x and y values is used as follows:
+
+    \code
+    QXYArrayDataSource *source = new QXYArrayDataSource(series);
+    source->setData(buffer, buffer + 1, count, 2);
+    series->setDataSource(source);
+    \endcode
+
+    When the values in the arrays change, emit pointsChanged() for the changed range.
+    When the arrays grow or shrink, call setData() again.
+*/
+
+/*!
+    Constructs an empty data source with the parent \a parent.
+*/
+QXYArrayDataSource::QXYArrayDataSource(QObject *parent)
+    : QXYDataSource(parent),
+      d_ptr(new QXYArrayDataSourcePrivate())
+{
+}
+
+/*!
+    Destroys the data source. The arrays are not deleted.
+*/
+QXYArrayDataSource::~QXYArrayDataSource()
+{
+}
+
+/*!
+    Sets the data source to read \a count data points from the arrays \a xData and \a yData.
+    The x value of the point at position \c i is \c {xData[i * stride]}, and the y value
+    is \c {yData[i * stride]}. A \a stride of \c 1 reads the values from consecutive
+    elements, and a \a stride of \c 2 reads them from an array of interleaved x and y values.
+
+    If the new arrays extend the previous ones, for example when a buffer is filled
+    gradually, pointsAdded() is emitted for the added points. Otherwise, reset() is emitted.
+*/
+void QXYArrayDataSource::setData(const double *xData, const double *yData, int count, int stride)
+{
+    Q_D(QXYArrayDataSource);
+    count = qMax(0, count);
+    stride = qMax(1, stride);
+    const int oldCount = d->m_count;
+    const bool extended = xData == d->m_xData && yData == d->m_yData && stride == d->m_stride
+            && count >= oldCount;
+    d->m_xData = xData;
+    d->m_yData = yData;
+    d->m_count = (xData && yData) ? count : 0;
+    d->m_stride = stride;
+
+    if (!extended)
+        emit reset();
+    else if (d->m_count > oldCount)
+        emit pointsAdded(oldCount, d->m_count - oldCount);
+}
+
+/*!
+    Returns the array of x values.
+*/
+const double *QXYArrayDataSource::xData() const
+{
+    Q_D(const QXYArrayDataSource);
+    return d->m_xData;
+}
+
+/*!
+    Returns the array of y values.
+*/
+const double *QXYArrayDataSource::yData() const
+{
+    Q_D(const QXYArrayDataSource);
+    return d->m_yData;
+}
+
+/*!
+    Returns the number of elements between consecutive values in the arrays.
+*/
+int QXYArrayDataSource::stride() const
+{
+    Q_D(const QXYArrayDataSource);
+    return d->m_stride;
+}
+
+/*!
+    \reimp
+*/
+int QXYArrayDataSource::count() const
+{
+    Q_D(const QXYArrayDataSource);
+    return d->m_count;
+}
+
+/*!
+    \reimp
+*/
+QPointF QXYArrayDataSource::at(int index) const
+{
+    Q_D(const QXYArrayDataSource);
+    const qsizetype offset = qsizetype(index) * d->m_stride;
+    return QPointF(d->m_xData[offset], d->m_yData[offset]);
+}
+
+/*!
+    \reimp
+*/
+void QXYArrayDataSource::readPoints(int index, int count, QPointF *points) const
+{
+    Q_D(const QXYArrayDataSource);
+    const qsizetype stride = d->m_stride;
+    const double *x = d->m_xData + qsizetype(index) * stride;
+    const double *y = d->m_yData + qsizetype(index) * stride;
+    for (int i = 0; i < count; i++, x += stride, y += stride)
+        points[i] = QPointF(*x, *y);
+}
+
+/*!
+    \class QXYFileDataSource
+    \inmodule QtCharts
+    \brief The QXYFileDataSource class provides the data points of an XY series from a
+    memory-mapped binary file.
+    \since 6.0
+
+    Recorded data, such as long measurement sessions with hundreds of millions of samples,
+    is often stored as binary columns of timestamps and values. QXYFileDataSource maps such
+    a file into memory and reads the data points directly from it, so the file does not have
+    to be parsed into a list of points, and only the parts of the data that are drawn are
+    read from the disk.
+
+    The layout of the file is described by the type, the byte offset of the first value,
+    and the byte distance between consecutive values of the x and y columns. Separate
+    columns and rows of interleaved values are supported. The values are stored in the byte
+    order of the host, and \c Int64 values are converted to \c qreal, which suits timestamps
+    in milliseconds since the epoch used by QDateTimeAxis.
+
+    For example, a file with a header of 64 bytes followed by \c count timestamps and
+    \c count measured values is read as follows:
+
+    \code
+    QXYFileDataSource *source = new QXYFileDataSource(series);
+    source->setFileName("session.bin");
+    source->setXColumn(QXYFileDataSource::Int64, 64);
+    source->setYColumn(QXYFileDataSource::Float32, 64 + count * sizeof(qint64));
+    if (source->open()) {
+        series->setDataSource(source);
+        series->setDecimationMode(QLineSeries::MinMaxDecimation);
+    }
+    \endcode
+
+    With QLineSeries::MinMaxDecimation, the series builds a summary of the lowest and
+    the highest values the first time the data is drawn, so that zoomed out views of the
+    whole file are drawn from the summary.
+
+    The file must not be truncated while it is open.
+
+    \sa QXYSeries::setDataSource()
+*/
+
+/*!
+    \enum QXYFileDataSource::ValueType
+
+    This enum describes the type of the values of a column.
+
+    \value Float32 32-bit floating point values.
+    \value Float64 64-bit floating point values.
+    \value Int64 64-bit signed integer values, such as timestamps.
+*/
+
+/*!
+    Constructs a data source with the parent \a parent. By default, the file is read
+    as interleaved pairs of \c Float64 x and y values.
+*/
+QXYFileDataSource::QXYFileDataSource(QObject *parent)
+    : QXYDataSource(parent),
+      d_ptr(new QXYFileDataSourcePrivate())
+{
+}
+
+/*!
+    Destroys the data source and closes the file.
+*/
+QXYFileDataSource::~QXYFileDataSource()
+{
+    Q_D(QXYFileDataSource);
+    d->closeFile();
+}
+
+/*!
+    Sets the name of the file to read to \a fileName. The file is read once open() is
+    called.
+*/
+void QXYFileDataSource::setFileName(const QString &fileName)
+{
+    Q_D(QXYFileDataSource);
+    d->m_file.setFileName(fileName);
+}
+
+/*!
+    Returns the name of the file.
+*/
+QString QXYFileDataSource::fileName() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_file.fileName();
+}
+
+/*!
+    Sets the x values to be read as values of the type \a type. The first value is read at
+    the byte position \a offset, and the following values are \a stride bytes apart. A
+    \a stride of \c 0 reads consecutive values.
+
+    If the file is open, reset() is emitted.
+*/
+void QXYFileDataSource::setXColumn(ValueType type, qint64 offset, qint64 stride)
+{
+    Q_D(QXYFileDataSource);
+    const QXYFileDataSourcePrivate::Column column = {
+        type, qMax(Q_INT64_C(0), offset), stride > 0 ? stride : d->valueSize(type)
+    };
+    d->m_xColumn = column;
+    if (d->m_open) {
+        d->updateCount();
+        emit reset();
+    }
+}
+
+/*!
+    Returns the type of the x values.
+*/
+QXYFileDataSource::ValueType QXYFileDataSource::xType() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_xColumn.type;
+}
+
+/*!
+    Returns the byte position of the first x value.
+*/
+qint64 QXYFileDataSource::xOffset() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_xColumn.offset;
+}
+
+/*!
+    Returns the number of bytes between consecutive x values.
+*/
+qint64 QXYFileDataSource::xStride() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_xColumn.stride;
+}
+
+/*!
+    Sets the y values to be read as values of the type \a type. The first value is read at
+    the byte position \a offset, and the following values are \a stride bytes apart. A
+    \a stride of \c 0 reads consecutive values.
+
+    If the file is open, reset() is emitted.
+*/
+void QXYFileDataSource::setYColumn(ValueType type, qint64 offset, qint64 stride)
+{
+    Q_D(QXYFileDataSource);
+    const QXYFileDataSourcePrivate::Column column = {
+        type, qMax(Q_INT64_C(0), offset), stride > 0 ? stride : d->valueSize(type)
+    };
+    d->m_yColumn = column;
+    if (d->m_open) {
+        d->updateCount();
+        emit reset();
+    }
+}
+
+/*!
+    Returns the type of the y values.
+*/
+QXYFileDataSource::ValueType QXYFileDataSource::yType() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_yColumn.type;
+}
+
+/*!
+    Returns the byte position of the first y value.
+*/
+qint64 QXYFileDataSource::yOffset() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_yColumn.offset;
+}
+
+/*!
+    Returns the number of bytes between consecutive y values.
+*/
+qint64 QXYFileDataSource::yStride() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_yColumn.stride;
+}
+
+/*!
+    Sets the number of data points stored in the file to \a count. A negative \a count,
+    which is the default, reads as many points as the file holds, which requires the
+    column ending last to run until the end of the file.
+
+    If the file is open, reset() is emitted.
+*/
+void QXYFileDataSource::setPointCount(int count)
+{
+    Q_D(QXYFileDataSource);
+    d->m_pointCount = qMax(-1, count);
+    if (d->m_open) {
+        d->updateCount();
+        emit reset();
+    }
+}
+
+/*!
+    Returns the number of data points set with setPointCount(), or \c -1 if the number
+    is determined from the size of the file.
+
+    \sa count()
+*/
+int QXYFileDataSource::pointCount() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_pointCount;
+}
+
+/*!
+    Opens and maps the file into memory. Returns \c true on success. On failure, the data
+    source is empty and errorString() describes the error. reset() is emitted in both cases.
+*/
+bool QXYFileDataSource::open()
+{
+    Q_D(QXYFileDataSource);
+    d->closeFile();
+    d->m_errorString.clear();
+
+    if (d->m_file.open(QIODevice::ReadOnly)) {
+        d->m_size = d->m_file.size();
+        if (d->m_size > 0)
+            d->m_data = d->m_file.map(0, d->m_size);
+        if (d->m_size > 0 && !d->m_data)
+            d->m_errorString = d->m_file.errorString();
+        else
+            d->m_open = d->updateCount();
+        if (!d->m_open)
+            d->closeFile();
+    } else {
+        d->m_errorString = d->m_file.errorString();
+    }
+
+    emit reset();
+    return d->m_open;
+}
+
+/*!
+    Unmaps and closes the file. The data source becomes empty, and reset() is emitted.
+*/
+void QXYFileDataSource::close()
+{
+    Q_D(QXYFileDataSource);
+    if (!d->m_open)
+        return;
+    d->closeFile();
+    emit reset();
+}
+
+/*!
+    Returns \c true if the file is open.
+*/
+bool QXYFileDataSource::isOpen() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_open;
+}
+
+/*!
+    Returns a description of the last error that occurred when opening the file, or an
+    empty string if there was none.
+*/
+QString QXYFileDataSource::errorString() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_errorString;
+}
+
+/*!
+    \reimp
+*/
+int QXYFileDataSource::count() const
+{
+    Q_D(const QXYFileDataSource);
+    return d->m_count;
+}
+
+/*!
+    \reimp
+*/
+QPointF QXYFileDataSource::at(int index) const
+{
+    Q_D(const QXYFileDataSource);
+    return QPointF(d->value(d->m_xColumn, index), d->value(d->m_yColumn, index));
+}
+
+/*!
+    \reimp
+*/
+void QXYFileDataSource::readPoints(int index, int count, QPointF *points) const
+{
+    Q_D(const QXYFileDataSource);
+    d->readColumn(d->m_xColumn, index, count, points, Qt::Horizontal);
+    d->readColumn(d->m_yColumn, index, count, points, Qt::Vertical);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+QXYArrayDataSourcePrivate::QXYArrayDataSourcePrivate()
+    : m_xData(nullptr),
+      m_yData(nullptr),
+      m_count(0),
+      m_stride(1)
+{
+}
+
+QXYFileDataSourcePrivate::QXYFileDataSourcePrivate()
+    : m_pointCount(-1),
+      m_data(nullptr),
+      m_size(0),
+      m_open(false),
+      m_count(0)
+{
+    const Column x = { QXYFileDataSource::Float64, 0, 16 };
+    const Column y = { QXYFileDataSource::Float64, 8, 16 };
+    m_xColumn = x;
+    m_yColumn = y;
+}
+
+void QXYFileDataSourcePrivate::closeFile()
+{
+    if (m_data)
+        m_file.unmap(const_cast<uchar *>(m_data));
+    m_file.close();
+    m_data = nullptr;
+    m_size = 0;
+    m_count = 0;
+    m_open = false;
+}
+
+int QXYFileDataSourcePrivate::valueSize(QXYFileDataSource::ValueType type)
+{
+    return type == QXYFileDataSource::Float32 ? int(sizeof(float)) : 8;
+}
+
+// Returns the number of values of the column that are within the file
+int QXYFileDataSourcePrivate::availableCount(const Column &column) const
+{
+    const qint64 available = m_size - column.offset - valueSize(column.type);
+    if (available < 0)
+        return 0;
+    return int(qMin(available / column.stride + 1, qint64(std::numeric_limits<int>::max())));
+}
+
+// Updates the number of points for the current layout. Returns false, and sets the error
+// string, if the file does not hold the number of points that was set.
+bool QXYFileDataSourcePrivate::updateCount()
+{
+    const int available = qMin(availableCount(m_xColumn), availableCount(m_yColumn));
+    if (m_pointCount > available) {
+        m_count = 0;
+        m_errorString = QXYFileDataSource::tr("The file holds %1 points, %2 were expected")
+                .arg(available).arg(m_pointCount);
+        return false;
+    }
+    m_count = m_pointCount >= 0 ? m_pointCount : available;
+    m_errorString.clear();
+    return true;
+}
+
+qreal QXYFileDataSourcePrivate::value(const Column &column, int index) const
+{
+    const uchar *data = m_data + column.offset + index * column.stride;
+    switch (column.type) {
+    case QXYFileDataSource::Float32:
+        return qFromUnaligned<float>(data);
+    case QXYFileDataSource::Int64:
+        return qreal(qFromUnaligned<qint64>(data));
+    default:
+        return qFromUnaligned<double>(data);
+    }
+}
+
+template <typename T>
+static void readValues(const uchar *data, qint64 stride, int count, QPointF *points,
+                       Qt::Orientation orientation)
+{
+    if (orientation == Qt::Horizontal) {
+        for (int i = 0; i < count; i++, data += stride)
+            points[i].setX(qreal(qFromUnaligned<T>(data)));
+    } else {
+        for (int i = 0; i < count; i++, data += stride)
+            points[i].setY(qreal(qFromUnaligned<T>(data)));
+    }
+}
+
+void QXYFileDataSourcePrivate::readColumn(const Column &column, int index, int count,
+                                          QPointF *points, Qt::Orientation orientation) const
+{
+    const uchar *data = m_data + column.offset + index * column.stride;
+    switch (column.type) {
+    case QXYFileDataSource::Float32:
+        readValues<float>(data, column.stride, count, points, orientation);
+        break;
+    case QXYFileDataSource::Int64:
+        readValues<qint64>(data, column.stride, count, points, orientation);
+        break;
+    default:
+        readValues<double>(data, column.stride, count, points, orientation);
+        break;
+    }
+}
+
+QT_CHARTS_END_NAMESPACE
+
+#include "moc_qxydatasource.cpp"
@@ -0,0 +1,135 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QXYDATASOURCE_H
+#define QXYDATASOURCE_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QObject>
+#include <QtCore/QPointF>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QXYArrayDataSourcePrivate;
+class QXYFileDataSourcePrivate;
+
+class Q_CHARTS_EXPORT QXYDataSource : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit QXYDataSource(QObject *parent = nullptr);
+    ~QXYDataSource();
+
+    virtual int count() const = 0;
+    virtual QPointF at(int index) const = 0;
+    virtual void readPoints(int index, int count, QPointF *points) const;
+
+Q_SIGNALS:
+    void pointsAdded(int index, int count);
+    void pointsRemoved(int index, int count);
+    void pointsChanged(int index, int count);
+    void reset();
+
+private:
+    Q_DISABLE_COPY(QXYDataSource)
+};
+
+class Q_CHARTS_EXPORT QXYArrayDataSource : public QXYDataSource
+{
+    Q_OBJECT
+
+public:
+    explicit QXYArrayDataSource(QObject *parent = nullptr);
+    ~QXYArrayDataSource();
+
+    void setData(const double *xData, const double *yData, int count, int stride = 1);
+    const double *xData() const;
+    const double *yData() const;
+    int stride() const;
+
+    int count() const override;
+    QPointF at(int index) const override;
+    void readPoints(int index, int count, QPointF *points) const override;
+
+private:
+    QScopedPointer<QXYArrayDataSourcePrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QXYArrayDataSource)
+    Q_DISABLE_COPY(QXYArrayDataSource)
+};
+
+class Q_CHARTS_EXPORT QXYFileDataSource : public QXYDataSource
+{
+    Q_OBJECT
+    Q_ENUMS(ValueType)
+
+public:
+    enum ValueType {
+        Float32,
+        Float64,
+        Int64
+    };
+
+    explicit QXYFileDataSource(QObject *parent = nullptr);
+    ~QXYFileDataSource();
+
+    void setFileName(const QString &fileName);
+    QString fileName() const;
+
+    void setXColumn(ValueType type, qint64 offset, qint64 stride = 0);
+    ValueType xType() const;
+    qint64 xOffset() const;
+    qint64 xStride() const;
+
+    void setYColumn(ValueType type, qint64 offset, qint64 stride = 0);
+    ValueType yType() const;
+    qint64 yOffset() const;
+    qint64 yStride() const;
+
+    void setPointCount(int count);
+    int pointCount() const;
+
+    bool open();
+    void close();
+    bool isOpen() const;
+    QString errorString() const;
+
+    int count() const override;
+    QPointF at(int index) const override;
+    void readPoints(int index, int count, QPointF *points) const override;
+
+private:
+    QScopedPointer<QXYFileDataSourcePrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QXYFileDataSource)
+    Q_DISABLE_COPY(QXYFileDataSource)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QXYDATASOURCE_H
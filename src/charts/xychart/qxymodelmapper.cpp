@@ -30,6 +30,7 @@
 #include <QtCharts/QXYModelMapper>
 #include <private/qxymodelmapper_p.h>
 #include <QtCharts/QXYSeries>
+#include <private/charthelpers_p.h>
 #include <QtCore/QAbstractItemModel>
 #include <QtCore/QDateTime>
 #include <QtCore/QDebug>
@@ -104,6 +105,7 @@ void QXYModelMapper::setSeries(QXYSeries *series)
     d->initializeXYFromModel();
     // connect the signals from the series
     connect(d->m_series, SIGNAL(pointAdded(int)), d, SLOT(handlePointAdded(int)));
+    connect(d->m_series, SIGNAL(pointsAdded(int,int)), d, SLOT(handlePointsAdded(int,int)));
     connect(d->m_series, SIGNAL(pointRemoved(int)), d, SLOT(handlePointRemoved(int)));
     connect(d->m_series, SIGNAL(pointReplaced(int)), d, SLOT(handlePointReplaced(int)));
     connect(d->m_series, SIGNAL(destroyed()), d, SLOT(handleSeriesDestroyed()));
@@ -302,8 +304,31 @@ void QXYModelMapperPrivate::handlePointAdded(int pointPos)
     else
         m_model->insertColumns(pointPos + m_first, 1);
 
-    setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
-    setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
+    const QPointF point = m_series->at(pointPos);
+    setValueToModel(xModelIndex(pointPos), point.x());
+    setValueToModel(yModelIndex(pointPos), point.y());
+    blockModelSignals(false);
+}
+
+void QXYModelMapperPrivate::handlePointsAdded(int pointPos, int count)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    if (m_count != -1)
+        m_count += count;
+
+    blockModelSignals();
+    if (m_orientation == Qt::Vertical)
+        m_model->insertRows(pointPos + m_first, count);
+    else
+        m_model->insertColumns(pointPos + m_first, count);
+
+    const QVector<QPointF> points = m_series->pointsVector();
+    for (int i = pointPos; i < pointPos + count; i++) {
+        setValueToModel(xModelIndex(i), points.at(i).x());
+        setValueToModel(yModelIndex(i), points.at(i).y());
+    }
     blockModelSignals(false);
 }
 
@@ -347,8 +372,9 @@ void QXYModelMapperPrivate::handlePointReplaced(int pointPos)
         return;
 
     blockModelSignals();
-    setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
-    setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
+    const QPointF point = m_series->at(pointPos);
+    setValueToModel(xModelIndex(pointPos), point.x());
+    setValueToModel(yModelIndex(pointPos), point.y());
     blockModelSignals(false);
 }
 
@@ -365,37 +391,42 @@ void QXYModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex bottom
     if (m_modelSignalsBlock)
         return;
 
+    // Only changes to the x and y sections affect the series
+    const bool vertical = m_orientation == Qt::Vertical;
+    const int firstSection = vertical ? topLeft.column() : topLeft.row();
+    const int lastSection = vertical ? bottomRight.column() : bottomRight.row();
+    if ((m_xSection < firstSection || m_xSection > lastSection)
+            && (m_ySection < firstSection || m_ySection > lastSection)) {
+        return;
+    }
+
+    int firstPos = qMax(0, (vertical ? topLeft.row() : topLeft.column()) - m_first);
+    int lastPos = qMin((vertical ? bottomRight.row() : bottomRight.column()) - m_first,
+                       m_series->count() - 1);
+    if (m_count != -1)
+        lastPos = qMin(lastPos, m_count - 1);
+    if (firstPos > lastPos)
+        return;
+
     blockSeriesSignals();
-    QModelIndex index;
-    QPointF oldPoint;
-    QPointF newPoint;
-    for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
-        for (int column = topLeft.column(); column <= bottomRight.column(); column++) {
-            index = topLeft.sibling(row, column);
-            if (m_orientation == Qt::Vertical && (index.column() == m_xSection || index.column() == m_ySection)) {
-                if (index.row() >= m_first && (m_count == - 1 || index.row() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.row() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.row() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.row() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                        m_series->replace(index.row() - m_first, newPoint);
-                    }
-                }
-            } else if (m_orientation == Qt::Horizontal && (index.row() == m_xSection || index.row() == m_ySection)) {
-                if (index.column() >= m_first && (m_count == - 1 || index.column() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.column() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.column() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.column() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                        m_series->replace(index.column() - m_first, newPoint);
-                    }
-                }
+    if (firstPos == lastPos) {
+        QModelIndex xIndex = xModelIndex(firstPos);
+        QModelIndex yIndex = yModelIndex(firstPos);
+        if (xIndex.isValid() && yIndex.isValid())
+            m_series->replace(firstPos, QPointF(valueFromModel(xIndex), valueFromModel(yIndex)));
+    } else {
+        // Replace all points at once, so that the series is updated only once
+        QVector<QPointF> points = m_series->pointsVector();
+        for (int pos = firstPos; pos <= lastPos; pos++) {
+            QModelIndex xIndex = xModelIndex(pos);
+            QModelIndex yIndex = yModelIndex(pos);
+            if (xIndex.isValid() && yIndex.isValid()) {
+                const QPointF point(valueFromModel(xIndex), valueFromModel(yIndex));
+                if (isValidValue(point))
+                    points[pos] = point;
             }
         }
+        m_series->replace(points);
     }
     blockSeriesSignals(false);
 }
@@ -461,6 +492,25 @@ void QXYModelMapperPrivate::handleModelDestroyed()
     m_model = 0;
 }
 
+// Returns the points mapped to the positions from pointPos on, up to count points or until the
+// first position that is not mapped when count is -1. Invalid points are skipped.
+QVector<QPointF> QXYModelMapperPrivate::pointsFromModel(int pointPos, int count)
+{
+    QVector<QPointF> points;
+    if (count > 0)
+        points.reserve(count);
+    for (int pos = pointPos; count == -1 || pos < pointPos + count; pos++) {
+        QModelIndex xIndex = xModelIndex(pos);
+        QModelIndex yIndex = yModelIndex(pos);
+        if (!xIndex.isValid() || !yIndex.isValid())
+            break;
+        const QPointF point(valueFromModel(xIndex), valueFromModel(yIndex));
+        if (isValidValue(point))
+            points.append(point);
+    }
+    return points;
+}
+
 void QXYModelMapperPrivate::insertData(int start, int end)
 {
     if (m_model == 0 || m_series == 0)
@@ -474,22 +524,12 @@ void QXYModelMapperPrivate::insertData(int start, int end)
             addedCount = m_count;
         int first = qMax(start, m_first);
         int last = qMin(first + addedCount - 1, m_orientation == Qt::Vertical ? m_model->rowCount() - 1 : m_model->columnCount() - 1);
-        for (int i = first; i <= last; i++) {
-            QPointF point;
-            QModelIndex xIndex = xModelIndex(i - m_first);
-            QModelIndex yIndex = yModelIndex(i - m_first);
-            if (xIndex.isValid() && yIndex.isValid()) {
-                point.setX(valueFromModel(xIndex));
-                point.setY(valueFromModel(yIndex));
-                m_series->insert(i - m_first, point);
-            }
-        }
+        if (first <= last)
+            m_series->insert(first - m_first, pointsFromModel(first - m_first, last - first + 1).toList());
 
         // remove excess of points (above m_count)
-        if (m_count != -1 && m_series->points().size() > m_count)
-            for (int i = m_series->points().size() - 1; i >= m_count; i--) {
-                m_series->remove(m_series->points().at(i));
-            }
+        if (m_count != -1 && m_series->count() > m_count)
+            m_series->removePoints(m_count, m_series->count() - m_count);
     }
 }
 
@@ -505,9 +545,8 @@ void QXYModelMapperPrivate::removeData(int start, int end)
         int toRemove = qMin(m_series->count(), removedCount);     // first find how many items can actually be removed
         int first = qMax(start, m_first);    // get the index of the first item that will be removed.
         int last = qMin(first + toRemove - 1, m_series->count() + m_first - 1);    // get the index of the last item that will be removed.
-        for (int i = last; i >= first; i--) {
-            m_series->remove(m_series->points().at(i - m_first));
-        }
+        if (first <= last)
+            m_series->removePoints(first - m_first, last - first + 1);
 
         if (m_count != -1) {
             int itemsAvailable;     // check how many are available to be added
@@ -516,18 +555,8 @@ void QXYModelMapperPrivate::removeData(int start, int end)
             else
                 itemsAvailable = m_model->columnCount() - m_first - m_series->count();
             int toBeAdded = qMin(itemsAvailable, m_count - m_series->count());     // add not more items than there is space left to be filled.
-            int currentSize = m_series->count();
             if (toBeAdded > 0)
-                for (int i = m_series->count(); i < currentSize + toBeAdded; i++) {
-                    QPointF point;
-                    QModelIndex xIndex = xModelIndex(i);
-                    QModelIndex yIndex = yModelIndex(i);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        point.setX(valueFromModel(xIndex));
-                        point.setY(valueFromModel(yIndex));
-                        m_series->insert(i, point);
-                    }
-                }
+                m_series->append(pointsFromModel(m_series->count(), toBeAdded).toList());
         }
     }
 }
@@ -538,27 +567,18 @@ void QXYModelMapperPrivate::initializeXYFromModel()
         return;
 
     blockSeriesSignals();
-    // clear current content
-    m_series->clear();
-
     // create the initial points set
-    int pointPos = 0;
-    QModelIndex xIndex = xModelIndex(pointPos);
-    QModelIndex yIndex = yModelIndex(pointPos);
+    QModelIndex xIndex = xModelIndex(0);
+    QModelIndex yIndex = yModelIndex(0);
 
     if (xIndex.isValid() && yIndex.isValid()) {
-        while (xIndex.isValid() && yIndex.isValid()) {
-            QPointF point;
-            point.setX(valueFromModel(xIndex));
-            point.setY(valueFromModel(yIndex));
-            m_series->append(point);
-            pointPos++;
-            xIndex = xModelIndex(pointPos);
-            yIndex = yModelIndex(pointPos);
-            // Don't warn about invalid index after the first, those are valid and used to
-            // determine when we should end looping.
-        }
+        // Replace the current content at once. Invalid indexes after the first one are valid
+        // and determine where the mapped points end, so don't warn about them.
+        m_series->replace(pointsFromModel(0));
     } else {
+        // clear current content
+        m_series->clear();
+
         // Invalid index right off the bat means series will be left empty, so output a warning,
         // unless model is also empty
         int count = m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount();
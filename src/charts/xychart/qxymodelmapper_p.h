@@ -72,6 +72,7 @@ public Q_SLOTS:
 
     // for the series
     void handlePointAdded(int pointPos);
+    void handlePointsAdded(int pointPos, int count);
     void handlePointRemoved(int pointPos);
     void handlePointsRemoved(int pointPos, int count);
     void handlePointReplaced(int pointPos);
@@ -82,6 +83,7 @@ public Q_SLOTS:
 private:
     QModelIndex xModelIndex(int xPos);
     QModelIndex yModelIndex(int yPos);
+    QVector<QPointF> pointsFromModel(int pointPos, int count = -1);
     void insertData(int start, int end);
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
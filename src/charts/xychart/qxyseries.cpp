@@ -32,10 +32,12 @@
 #include <private/abstractdomain_p.h>
 #include <QtCharts/QValueAxis>
 #include <private/xychart_p.h>
+#include <private/xydecimator_p.h>
 #include <QtCharts/QXYLegendMarker>
 #include <private/charthelpers_p.h>
 #include <private/qchart_p.h>
 #include <QtGui/QPainter>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -251,6 +253,35 @@ QT_CHARTS_BEGIN_NAMESPACE
     \a clipping.
 */
 
+/*!
+    \property QXYSeries::capacity
+    \brief The maximum number of data points kept in the series.
+
+    When the capacity is set, the series acts as a sliding window: appending a
+    data point to a full series removes the oldest data point first. Appending
+    to a full series does not move the stored points, which makes the capacity
+    suitable for streaming data, such as oscilloscope or monitoring views.
+    Setting a capacity smaller than the current number of points removes the
+    oldest points.
+
+    This property is \c 0 by default, which means that the number of points is
+    not limited.
+
+    \sa pointsRemoved(), pointAdded()
+*/
+/*!
+    \qmlproperty int XYSeries::capacity
+    The maximum number of data points kept in the series. When the capacity is
+    set, appending a data point to a full series removes the oldest data point
+    first. This property is \c 0 by default, which means that the number of
+    points is not limited.
+*/
+/*!
+    \fn void QXYSeries::capacityChanged(int capacity)
+    This signal is emitted when the capacity of the series changes to
+    \a capacity.
+*/
+
 /*!
     \fn void QXYSeries::clicked(const QPointF& point)
     This signal is emitted when the user triggers a mouse event by
@@ -392,16 +423,40 @@ QT_CHARTS_BEGIN_NAMESPACE
     \fn void QXYSeries::pointAdded(int index)
     This signal is emitted when a point is added at the position specified by
     \a index.
-    \sa append(), insert()
+
+    \note Since Qt 6.0, this signal is only emitted for points added one at a
+    time. Appending or inserting a list of points emits pointsAdded() once for
+    the whole list instead of this signal for each point.
+    \sa append(), insert(), pointsAdded()
 */
 /*!
     \qmlsignal XYSeries::pointAdded(int index)
     This signal is emitted when a point is added at the position specified by
     \a index.
 
+    \note Since QtCharts 2.15, this signal is only emitted for points added one
+    at a time. The XYPoint children of a series are added as one block, which
+    emits pointsAdded() instead.
+
     The corresponding signal handler is \c onPointAdded().
 */
 
+/*!
+    \fn void QXYSeries::pointsAdded(int index, int count)
+    \since 6.0
+    This signal is emitted when the number of points specified by \a count
+    is added starting at the position specified by \a index.
+    \sa append(), insert()
+*/
+/*!
+    \qmlsignal XYSeries::pointsAdded(int index, int count)
+    \since QtCharts 2.15
+    This signal is emitted when the number of points specified by \a count
+    is added starting at the position specified by \a index.
+
+    The corresponding signal handler is \c onPointsAdded().
+*/
+
 /*!
     \fn void QXYSeries::pointRemoved(int index)
     This signal is emitted when a point is removed from the position specified
@@ -526,8 +581,33 @@ void QXYSeries::append(const QPointF &point)
 {
     Q_D(QXYSeries);
 
+    if (d->isReadOnly())
+        return;
+
     if (isValidValue(point)) {
+        if (d->m_capacity > 0 && d->m_points.size() == d->m_capacity && !d->m_ringSlotFree) {
+            // The window is full: release the oldest slot and reuse it for the new point,
+            // so that appending does not move the stored points around.
+            d->m_ringStart = (d->m_ringStart + 1) % d->m_capacity;
+            d->m_ringSlotFree = true;
+            d->updateSortedByX(0, 0, true);
+            d->m_minMaxPyramid.removeFirst(1);
+            d->m_shifting = true;
+            emit pointsRemoved(0, 1);
+            d->m_shifting = false;
+            // A receiver may have linearized the buffer, in which case the point is
+            // appended normally below
+            if (d->m_ringSlotFree) {
+                d->m_points[(d->m_ringStart + d->m_capacity - 1) % d->m_capacity] = point;
+                d->m_ringSlotFree = false;
+                d->updateSortedByX(d->m_capacity - 1, 1, false);
+                emit pointAdded(d->m_capacity - 1);
+                return;
+            }
+        }
+        d->trimToCapacity(1, true);
         d->m_points << point;
+        d->updateSortedByX(d->m_points.count() - 1, 1, false);
         emit pointAdded(d->m_points.count() - 1);
     }
 }
@@ -535,11 +615,19 @@ void QXYSeries::append(const QPointF &point)
 /*!
    \overload
    Adds the list of data points specified by \a points to the series.
+   Invalid data points are skipped.
+
+   QXYSeries::pointsAdded() is emitted once for the whole list, which is much
+   faster than appending the points one by one.
+
+   \note Since Qt 6.0, pointAdded() is no longer emitted for each of the
+   points. Code that handled pointAdded() for lists of points needs to handle
+   pointsAdded() as well.
+   \sa pointsAdded(), pointAdded()
  */
 void QXYSeries::append(const QList<QPointF> &points)
 {
-    foreach (const QPointF &point , points)
-        append(point);
+    insert(count(), points);
 }
 
 /*!
@@ -562,6 +650,7 @@ void QXYSeries::replace(qreal oldX, qreal oldY, qreal newX, qreal newY)
 void QXYSeries::replace(const QPointF &oldPoint, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
+    d->linearize();
     int index = d->m_points.indexOf(oldPoint);
     if (index == -1)
         return;
@@ -586,8 +675,12 @@ void QXYSeries::replace(int index, qreal newX, qreal newY)
 void QXYSeries::replace(int index, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
+    if (d->isReadOnly())
+        return;
     if (isValidValue(newPoint)) {
-        d->m_points[index] = newPoint;
+        d->m_points[d->physicalIndex(index)] = newPoint;
+        d->updateSortedByX(index, 1, true);
+        d->invalidateMinMaxPyramid(index);
         emit pointReplaced(index);
     }
 }
@@ -602,7 +695,15 @@ void QXYSeries::replace(int index, const QPointF &newPoint)
 void QXYSeries::replace(QVector<QPointF> points)
 {
     Q_D(QXYSeries);
+    if (d->isReadOnly())
+        return;
+    if (d->m_capacity > 0 && points.size() > d->m_capacity)
+        points.remove(0, points.size() - d->m_capacity);
     d->m_points = points;
+    d->m_ringStart = 0;
+    d->m_ringSlotFree = false;
+    d->m_sortedByXKnown = false;
+    d->m_minMaxPyramid.clear();
     emit pointsReplaced();
 }
 
@@ -622,6 +723,7 @@ void QXYSeries::remove(qreal x, qreal y)
 void QXYSeries::remove(const QPointF &point)
 {
     Q_D(QXYSeries);
+    d->linearize();
     int index = d->m_points.indexOf(point);
     if (index == -1)
         return;
@@ -635,7 +737,12 @@ void QXYSeries::remove(const QPointF &point)
 void QXYSeries::remove(int index)
 {
     Q_D(QXYSeries);
+    if (d->isReadOnly())
+        return;
+    d->linearize();
     d->m_points.remove(index);
+    d->updateSortedByX(index, 0, true);
+    d->invalidateMinMaxPyramid(index);
     emit pointRemoved(index);
 }
 
@@ -649,8 +756,11 @@ void QXYSeries::removePoints(int index, int count)
     // This function doesn't overload remove as there is chance for it to get mixed up with
     // remove(qreal, qreal) overload in some implicit casting cases.
     Q_D(QXYSeries);
-    if (count > 0) {
+    if (count > 0 && !d->isReadOnly()) {
+        d->linearize();
         d->m_points.remove(index, count);
+        d->updateSortedByX(index, 0, true);
+        d->invalidateMinMaxPyramid(index);
         emit pointsRemoved(index, count);
     }
 }
@@ -663,21 +773,65 @@ void QXYSeries::removePoints(int index, int count)
 void QXYSeries::insert(int index, const QPointF &point)
 {
     Q_D(QXYSeries);
+    if (d->isReadOnly())
+        return;
     if (isValidValue(point)) {
+        index -= d->trimToCapacity(1, index >= count());
         index = qMax(0, qMin(index, d->m_points.size()));
         d->m_points.insert(index, point);
+        d->updateSortedByX(index, 1, false);
+        d->invalidateMinMaxPyramid(index);
         emit pointAdded(index);
     }
 }
 
+/*!
+  \overload
+  \since 6.0
+  Inserts the list of data points specified by \a points in the series starting
+  at the position specified by \a index. Invalid data points are skipped.
+
+  QXYSeries::pointsAdded() is emitted once for the whole list, and
+  pointAdded() is not emitted for the points.
+  \sa pointsAdded()
+*/
+void QXYSeries::insert(int index, const QList<QPointF> &points)
+{
+    Q_D(QXYSeries);
+    if (d->isReadOnly())
+        return;
+
+    QVector<QPointF> validPoints;
+    validPoints.reserve(points.size());
+    for (const QPointF &point : points) {
+        if (isValidValue(point))
+            validPoints.append(point);
+    }
+    if (d->m_capacity > 0 && validPoints.size() > d->m_capacity)
+        validPoints.remove(0, validPoints.size() - d->m_capacity);
+    if (validPoints.isEmpty())
+        return;
+
+    index -= d->trimToCapacity(int(validPoints.size()), index >= count());
+    index = qBound(0, index, int(d->m_points.size()));
+    if (index == d->m_points.size()) {
+        d->m_points.append(validPoints);
+    } else {
+        d->m_points.insert(index, validPoints.size(), QPointF());
+        std::copy(validPoints.cbegin(), validPoints.cend(), d->m_points.begin() + index);
+    }
+    d->updateSortedByX(index, int(validPoints.size()), false);
+    d->invalidateMinMaxPyramid(index);
+    emit pointsAdded(index, int(validPoints.size()));
+}
+
 /*!
   Removes all points from the series.
   \sa pointsRemoved()
 */
 void QXYSeries::clear()
 {
-    Q_D(QXYSeries);
-    removePoints(0, d->m_points.size());
+    removePoints(0, count());
 }
 
 /*!
@@ -687,27 +841,60 @@ void QXYSeries::clear()
 QList<QPointF> QXYSeries::points() const
 {
     Q_D(const QXYSeries);
+    if (d->m_dataSource)
+        return d->pointsRange(0, count()).toList();
+    d->linearize();
     return d->m_points.toList();
 }
 
 /*!
     Returns the points in the series as a vector.
-    This is more efficient than calling points().
+    This is more efficient than calling points(). If the series has a data source,
+    the points are copied from it.
 */
 QVector<QPointF> QXYSeries::pointsVector() const
 {
     Q_D(const QXYSeries);
+    if (d->m_dataSource)
+        return d->pointsRange(0, count());
+    d->linearize();
     return d->m_points;
 }
 
 /*!
     Returns the data point at the position specified by \a index in the internal
-    points vector.
+    points vector. If the series has a data source, the points around \a index are
+    read from it into a cache, and the returned reference stays valid until the
+    points of the data source change.
 */
 const QPointF &QXYSeries::at(int index) const
 {
     Q_D(const QXYSeries);
-    return d->m_points.at(index);
+    if (d->m_dataSource)
+        return d->sourcePointRef(index);
+    return d->m_points.at(d->physicalIndex(index));
+}
+
+/*!
+    \since 6.0
+    Returns the index of the data point drawn closest to \a position, or \c -1 if
+    no point is drawn within \a maxDistance pixels of it. The position is given in
+    chart coordinates, like the positions returned by QChart::mapToPosition(). A
+    negative \a maxDistance does not limit the distance.
+
+    The points are looked up from a spatial index of the drawn points, which is
+    built on the first call after the chart has been redrawn. The lookup takes
+    constant time on average, so this function is cheap enough to be called on
+    every mouse move even for large series. When the series is decimated, only
+    the points that are drawn are considered. The function returns \c -1 if the
+    series has not been added to a chart.
+
+    \sa QChart::nearestPointIndex()
+*/
+int QXYSeries::nearestPointIndex(const QPointF &position, qreal maxDistance) const
+{
+    Q_D(const QXYSeries);
+    return d->nearestPoint(position, maxDistance);
 }
 
 /*!
@@ -716,7 +903,64 @@ const QPointF &QXYSeries::at(int index) const
 int QXYSeries::count() const
 {
     Q_D(const QXYSeries);
-    return d->m_points.count();
+    if (d->m_dataSource)
+        return d->m_dataSource->count();
+    return d->m_points.count() - (d->m_ringSlotFree ? 1 : 0);
+}
+
+/*!
+    \since 6.0
+    Sets the series to read its data points from \a source instead of storing them.
+    The points stored in the series are removed. Passing \c nullptr detaches the series
+    from its data source and leaves it empty. The series does not take ownership of
+    the data source, and becomes empty if the data source is deleted.
+
+    While the series has a data source, its points cannot be modified through the
+    series, and the capacity is not applied. The chart maps only the points in the
+    visible range of a line series that has ascending x values, so the points are
+    read from the data source as needed instead of being copied. With
+    QLineSeries::MinMaxDecimation, zoomed out views are drawn from a summary of the
+    lowest and highest values, so that the data points are not all read again.
+    QXYSeries::pointsReplaced() is emitted when the data source is changed.
+
+    \sa QXYDataSource, dataSource()
+*/
+void QXYSeries::setDataSource(QXYDataSource *source)
+{
+    Q_D(QXYSeries);
+    if (d->m_dataSource == source)
+        return;
+
+    if (d->m_dataSource)
+        d->m_dataSource->disconnect(d);
+    d->m_dataSource = source;
+    d->clearSourceBlocks();
+    d->m_points.clear();
+    d->m_ringStart = 0;
+    d->m_ringSlotFree = false;
+    d->m_sortedByXKnown = false;
+    d->m_minMaxPyramid.clear();
+    if (source) {
+        connect(source, SIGNAL(pointsAdded(int,int)), d, SLOT(handleSourcePointsAdded(int,int)));
+        connect(source, SIGNAL(pointsRemoved(int,int)), d, SLOT(handleSourcePointsRemoved(int,int)));
+        connect(source, SIGNAL(pointsChanged(int,int)), d, SLOT(handleSourcePointsChanged(int,int)));
+        connect(source, SIGNAL(reset()), d, SLOT(handleSourceReset()));
+        connect(source, SIGNAL(destroyed()), d, SLOT(handleSourceReset()));
+    }
+    emit pointsReplaced();
+}
+
+/*!
+    \since 6.0
+    Returns the data source the series reads its points from, or \c nullptr if the
+    series stores its points.
+
+    \sa setDataSource()
+*/
+QXYDataSource *QXYSeries::dataSource() const
+{
+    Q_D(const QXYSeries);
+    return d->m_dataSource.data();
 }
 
 
@@ -877,6 +1121,23 @@ bool QXYSeries::pointLabelsClipping() const
     return d->m_pointLabelsClipping;
 }
 
+void QXYSeries::setCapacity(int capacity)
+{
+    Q_D(QXYSeries);
+    capacity = qMax(0, capacity);
+    if (d->m_capacity != capacity) {
+        d->m_capacity = capacity;
+        d->trimToCapacity(0);
+        emit capacityChanged(capacity);
+    }
+}
+
+int QXYSeries::capacity() const
+{
+    Q_D(const QXYSeries);
+    return d->m_capacity;
+}
+
 /*!
     Stream operator for adding the data point \a point to the series.
     \sa append()
@@ -905,6 +1166,12 @@ QXYSeries &QXYSeries::operator<< (const QList<QPointF>& points)
 
 QXYSeriesPrivate::QXYSeriesPrivate(QXYSeries *q)
     : QAbstractSeriesPrivate(q),
+      m_ringStart(0),
+      m_ringSlotFree(false),
+      m_capacity(0),
+      m_shifting(false),
+      m_sortedByXKnown(true),
+      m_sortedByX(true),
       m_pen(QChartPrivate::defaultPen()),
       m_brush(QChartPrivate::defaultBrush()),
       m_pointsVisible(false),
@@ -916,6 +1183,277 @@ QXYSeriesPrivate::QXYSeriesPrivate(QXYSeries *q)
 {
 }
 
+/*!
+    \internal
+    Restores the plain layout of the points storage after it has been used as a ring buffer.
+*/
+void QXYSeriesPrivate::linearize() const
+{
+    if (m_ringStart != 0) {
+        std::rotate(m_points.begin(), m_points.begin() + m_ringStart, m_points.end());
+        m_ringStart = 0;
+    }
+    if (m_ringSlotFree) {
+        // The released slot is the last one after rotation
+        m_points.removeLast();
+        m_ringSlotFree = false;
+    }
+}
+
+/*!
+    \internal
+    Returns true if the x values of the points are in ascending order. The result is cached.
+*/
+bool QXYSeriesPrivate::isSortedByX() const
+{
+    if (!m_sortedByXKnown) {
+        if (m_dataSource) {
+            m_sortedByX = XYDecimator::isSortedByX(m_dataSource.data());
+        } else if (isLinear()) {
+            m_sortedByX = XYDecimator::isSortedByX(m_points);
+        } else {
+            m_sortedByX = XYDecimator::isSortedByX(
+                        pointsRange(0, int(m_points.size()) - (m_ringSlotFree ? 1 : 0)));
+        }
+        m_sortedByXKnown = true;
+    }
+    return m_sortedByX;
+}
+
+/*!
+    \internal
+    Updates the cached sortedness after \a count points starting at \a index were added or
+    replaced. Only the changed points and their neighbours are checked. If the change can
+    restore the order of unsorted points (\a mayBecomeSorted), such as removing or replacing
+    points, the unsorted state is forgotten and determined again on demand.
+*/
+void QXYSeriesPrivate::updateSortedByX(int index, int count, bool mayBecomeSorted)
+{
+    if (!m_sortedByXKnown)
+        return;
+    if (!m_sortedByX) {
+        if (mayBecomeSorted)
+            m_sortedByXKnown = false;
+        return;
+    }
+
+    Q_Q(QXYSeries);
+    const int first = qMax(0, index - 1);
+    const int last = qMin(q->count() - 1, index + count);
+    for (int i = first; i < last; ++i) {
+        if (pointAt(i + 1).x() < pointAt(i).x()) {
+            m_sortedByX = false;
+            return;
+        }
+    }
+}
+
+/*!
+    \internal
+    Removes the oldest points so that \a incoming points fit within the capacity of the series.
+    Returns the number of removed points. \a appending tells that the incoming points are added
+    to the end of the series.
+*/
+int QXYSeriesPrivate::trimToCapacity(int incoming, bool appending)
+{
+    Q_Q(QXYSeries);
+    linearize();
+    if (m_capacity <= 0)
+        return 0;
+
+    const int excess = qMin(int(m_points.size()) + incoming - m_capacity, int(m_points.size()));
+    if (excess <= 0)
+        return 0;
+
+    m_points.remove(0, excess);
+    updateSortedByX(0, 0, true);
+    m_minMaxPyramid.removeFirst(excess);
+    m_shifting = appending;
+    emit q->pointsRemoved(0, excess);
+    m_shifting = false;
+    return excess;
+}
+
+/*!
+    \internal
+    Returns the index of the drawn point closest to \a position in chart coordinates,
+    or -1 if there is none within \a maxDistance. The distance of the point is stored
+    in \a distance if it is given.
+*/
+int QXYSeriesPrivate::nearestPoint(const QPointF &position, qreal maxDistance,
+                                   qreal *distance) const
+{
+    XYChart *item = static_cast<XYChart *>(m_item.data());
+    if (!m_chart || !item)
+        return -1;
+    return item->nearestPoint(position - m_chart->plotArea().topLeft(), maxDistance, distance);
+}
+
+/*!
+    \internal
+    Returns \a count points starting at \a index. Only the requested points are read from
+    the data source, and the stored points are shared when all of them are requested. Points
+    stored as a ring buffer are copied in order without restoring the plain layout.
+*/
+QVector<QPointF> QXYSeriesPrivate::pointsRange(int index, int count) const
+{
+    if (m_dataSource) {
+        QVector<QPointF> points(count);
+        if (count > 0)
+            m_dataSource->readPoints(index, count, points.data());
+        return points;
+    }
+    if (isLinear())
+        return m_points.mid(index, count);
+
+    QVector<QPointF> points(count);
+    for (int i = 0; i < count; ) {
+        // Copy up to the end of the storage, then continue from its start
+        const int physical = physicalIndex(index + i);
+        const int size = qMin(count - i, int(m_points.size()) - physical);
+        std::copy(m_points.cbegin() + physical, m_points.cbegin() + physical + size,
+                  points.begin() + i);
+        i += size;
+    }
+    return points;
+}
+
+/*!
+    \internal
+    Returns true, and warns, if the points are read from a data source and cannot be modified.
+*/
+bool QXYSeriesPrivate::isReadOnly() const
+{
+    if (!m_dataSource)
+        return false;
+    qWarning("QXYSeries: The points of a series that has a data source cannot be modified");
+    return true;
+}
+
+/*!
+    \internal
+    Returns the min/max pyramid of the points. The pyramid is built when it is first needed
+    and extended with the points appended since, so that appending does not rebuild it.
+*/
+const XYMinMaxPyramid *QXYSeriesPrivate::minMaxPyramid() const
+{
+    if (!m_dataSource) {
+        // Points stored as a ring buffer are appended in the contiguous parts of the storage
+        const int count = int(m_points.size()) - (m_ringSlotFree ? 1 : 0);
+        for (int start = m_minMaxPyramid.count(); start < count; ) {
+            const int physical = physicalIndex(start);
+            const int size = qMin(count - start, int(m_points.size()) - physical);
+            m_minMaxPyramid.append(m_points.constData() + physical, size);
+            start += size;
+        }
+        return &m_minMaxPyramid;
+    }
+
+    // Read the points in blocks instead of copying all of them
+    const int count = m_dataSource->count();
+    const int blockSize = 4096;
+    QVector<QPointF> block;
+    for (int start = m_minMaxPyramid.count(); start < count; start += blockSize) {
+        const int size = qMin(blockSize, count - start);
+        block.resize(size);
+        m_dataSource->readPoints(start, size, block.data());
+        m_minMaxPyramid.append(block.constData(), size);
+    }
+    return &m_minMaxPyramid;
+}
+
+/*!
+    \internal
+    Drops the min/max pyramid if it summarizes points from \a index on. Points appended
+    after the summarized points leave it intact.
+*/
+void QXYSeriesPrivate::invalidateMinMaxPyramid(int index)
+{
+    if (index < m_minMaxPyramid.count())
+        m_minMaxPyramid.clear();
+}
+
+/*!
+    \internal
+    Returns the point at \a index by value. The series and the charts read single points
+    with this instead of QXYSeries::at(), which keeps data source points in a cache.
+*/
+QPointF QXYSeriesPrivate::pointAt(int index) const
+{
+    if (m_dataSource)
+        return m_dataSource->at(index);
+    return m_points.at(physicalIndex(index));
+}
+
+static const int sourceBlockSize = 1024;
+
+/*!
+    \internal
+    Returns a reference to the data source point at \a index. The block of points around it
+    is read into m_sourceBlocks, where it stays until the points of the data source change,
+    so the reference is not overwritten by reading other points.
+*/
+const QPointF &QXYSeriesPrivate::sourcePointRef(int index) const
+{
+    Q_ASSERT(m_dataSource);
+    QMutexLocker locker(&m_sourceBlocksMutex);
+    const int block = index / sourceBlockSize;
+    const int first = block * sourceBlockSize;
+    QVector<QPointF> &points = m_sourceBlocks[block];
+    if (points.isEmpty()) {
+        points.resize(qMin(sourceBlockSize, m_dataSource->count() - first));
+        m_dataSource->readPoints(first, int(points.size()), points.data());
+    }
+    return points.at(index - first);
+}
+
+void QXYSeriesPrivate::clearSourceBlocks()
+{
+    QMutexLocker locker(&m_sourceBlocksMutex);
+    m_sourceBlocks.clear();
+}
+
+void QXYSeriesPrivate::handleSourcePointsAdded(int index, int count)
+{
+    Q_Q(QXYSeries);
+    clearSourceBlocks();
+    invalidateMinMaxPyramid(index);
+    updateSortedByX(index, count, false);
+    emit q->pointsAdded(index, count);
+}
+
+void QXYSeriesPrivate::handleSourcePointsRemoved(int index, int count)
+{
+    Q_Q(QXYSeries);
+    clearSourceBlocks();
+    invalidateMinMaxPyramid(index);
+    updateSortedByX(index, 0, true);
+    emit q->pointsRemoved(index, count);
+}
+
+void QXYSeriesPrivate::handleSourcePointsChanged(int index, int count)
+{
+    Q_Q(QXYSeries);
+    clearSourceBlocks();
+    invalidateMinMaxPyramid(index);
+    if (count == 1) {
+        updateSortedByX(index, 1, true);
+        emit q->pointReplaced(index);
+    } else if (count > 1) {
+        m_sortedByXKnown = false;
+        emit q->pointsReplaced();
+    }
+}
+
+void QXYSeriesPrivate::handleSourceReset()
+{
+    Q_Q(QXYSeries);
+    clearSourceBlocks();
+    m_minMaxPyramid.clear();
+    m_sortedByXKnown = false;
+    emit q->pointsReplaced();
+}
+
 void QXYSeriesPrivate::initializeDomain()
 {
     qreal minX(0);
@@ -925,21 +1463,26 @@ void QXYSeriesPrivate::initializeDomain()
 
     Q_Q(QXYSeries);
 
-    const QVector<QPointF> &points = q->pointsVector();
-
-    if (!points.isEmpty()) {
-        minX = points[0].x();
-        minY = points[0].y();
+    const int count = q->count();
+    if (count > 0) {
+        const QPointF first = pointAt(0);
+        minX = first.x();
+        minY = first.y();
         maxX = minX;
         maxY = minY;
 
-        for (int i = 0; i < points.count(); i++) {
-            qreal x = points[i].x();
-            qreal y = points[i].y();
-            minX = qMin(minX, x);
-            minY = qMin(minY, y);
-            maxX = qMax(maxX, x);
-            maxY = qMax(maxY, y);
+        // Read data source points in blocks instead of copying all of them
+        const int blockSize = m_dataSource ? 4096 : count;
+        for (int start = 0; start < count; start += blockSize) {
+            const QVector<QPointF> points = pointsRange(start, qMin(blockSize, count - start));
+            for (int i = 0; i < points.count(); i++) {
+                qreal x = points[i].x();
+                qreal y = points[i].y();
+                minX = qMin(minX, x);
+                minY = qMin(minY, y);
+                maxX = qMax(maxX, x);
+                maxY = qMax(maxY, y);
+            }
         }
     }
 
@@ -991,6 +1534,8 @@ void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QVector<QP
     if (points.size() == 0)
         return;
 
+    linearize();
+
     static const QString xPointTag(QLatin1String("@xPoint"));
     static const QString yPointTag(QLatin1String("@yPoint"));
     const int labelOffset = offset + 2;
@@ -1002,11 +1547,13 @@ void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QVector<QP
     QFontMetrics fm(painter->font());
     // m_points is used for the label here as it has the series point information
     // points variable passed is used for positioning because it has the coordinates
-    const int pointCount = qMin(points.size(), m_points.size());
+    Q_Q(QXYSeries);
+    const int pointCount = qMin(int(points.size()), q->count());
     for (int i(0); i < pointCount; i++) {
+        const QPointF point = m_dataSource ? m_dataSource->at(i) : m_points.at(i);
         QString pointLabel = m_pointLabelsFormat;
-        pointLabel.replace(xPointTag, presenter()->numberToString(m_points.at(i).x()));
-        pointLabel.replace(yPointTag, presenter()->numberToString(m_points.at(i).y()));
+        pointLabel.replace(xPointTag, presenter()->numberToString(point.x()));
+        pointLabel.replace(yPointTag, presenter()->numberToString(point.y()));
 
         // Position text in relation to the point
         int pointLabelWidth = fm.horizontalAdvance(pointLabel);
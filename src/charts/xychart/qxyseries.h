@@ -43,6 +43,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 class QXYSeriesPrivate;
 class QXYModelMapper;
+class QXYDataSource;
 
 class Q_CHARTS_EXPORT QXYSeries : public QAbstractSeries
 {
@@ -54,6 +55,7 @@ class Q_CHARTS_EXPORT QXYSeries : public QAbstractSeries
     Q_PROPERTY(QFont pointLabelsFont READ pointLabelsFont WRITE setPointLabelsFont NOTIFY pointLabelsFontChanged)
     Q_PROPERTY(QColor pointLabelsColor READ pointLabelsColor WRITE setPointLabelsColor NOTIFY pointLabelsColorChanged)
     Q_PROPERTY(bool pointLabelsClipping READ pointLabelsClipping WRITE setPointLabelsClipping NOTIFY pointLabelsClippingChanged)
+    Q_PROPERTY(int capacity READ capacity WRITE setCapacity NOTIFY capacityChanged)
 
 protected:
     explicit QXYSeries(QXYSeriesPrivate &d, QObject *parent = nullptr);
@@ -72,12 +74,14 @@ public:
     void remove(int index);
     void removePoints(int index, int count);
     void insert(int index, const QPointF &point);
+    void insert(int index, const QList<QPointF> &points);
     void clear();
 
     int count() const;
     QList<QPointF> points() const;
     QVector<QPointF> pointsVector() const;
     const QPointF &at(int index) const;
+    int nearestPointIndex(const QPointF &position, qreal maxDistance = -1) const;
 
     QXYSeries &operator << (const QPointF &point);
     QXYSeries &operator << (const QList<QPointF> &points);
@@ -109,8 +113,14 @@ public:
     void setPointLabelsClipping(bool enabled = true);
     bool pointLabelsClipping() const;
 
+    void setCapacity(int capacity);
+    int capacity() const;
+
     void replace(QVector<QPointF> points);
 
+    void setDataSource(QXYDataSource *source);
+    QXYDataSource *dataSource() const;
+
 Q_SIGNALS:
     void clicked(const QPointF &point);
     void hovered(const QPointF &point, bool state);
@@ -120,6 +130,7 @@ Q_SIGNALS:
     void pointReplaced(int index);
     void pointRemoved(int index);
     void pointAdded(int index);
+    void pointsAdded(int index, int count);
     void colorChanged(QColor color);
     void pointsReplaced();
     void pointLabelsFormatChanged(const QString &format);
@@ -129,6 +140,7 @@ Q_SIGNALS:
     void pointLabelsClippingChanged(bool clipping);
     void pointsRemoved(int index, int count);
     void penChanged(const QPen &pen);
+    void capacityChanged(int capacity);
 
 private:
     Q_DECLARE_PRIVATE(QXYSeries)
@@ -136,6 +148,7 @@ private:
     friend class QXYLegendMarkerPrivate;
     friend class XYLegendMarker;
     friend class XYChart;
+    friend class GLXYSeriesDataManager;
 };
 
 QT_CHARTS_END_NAMESPACE
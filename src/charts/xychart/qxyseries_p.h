@@ -41,6 +41,11 @@
 
 #include <private/qabstractseries_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <private/xyminmaxpyramid_p.h>
+#include <QtCharts/QXYDataSource>
+#include <QtCore/QPointer>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -67,11 +72,61 @@ public:
     void drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
                                const int offset = 0);
 
+    void linearize() const;
+    int trimToCapacity(int incoming, bool appending = false);
+    int physicalIndex(int index) const
+    {
+        return m_ringStart ? (m_ringStart + index) % int(m_points.size()) : index;
+    }
+    bool isLinear() const { return m_ringStart == 0 && !m_ringSlotFree; }
+    bool isShifting() const { return m_shifting; }
+
+    bool isSortedByX() const;
+    void updateSortedByX(int index, int count, bool mayBecomeSorted);
+
+    int nearestPoint(const QPointF &position, qreal maxDistance, qreal *distance = nullptr) const;
+
+    QXYDataSource *dataSource() const { return m_dataSource.data(); }
+    QPointF pointAt(int index) const;
+    const QPointF &sourcePointRef(int index) const;
+    void clearSourceBlocks();
+    QVector<QPointF> pointsRange(int index, int count) const;
+    bool isReadOnly() const;
+    const XYMinMaxPyramid *minMaxPyramid() const;
+    void invalidateMinMaxPyramid(int index);
+
+public Q_SLOTS:
+    void handleSourcePointsAdded(int index, int count);
+    void handleSourcePointsRemoved(int index, int count);
+    void handleSourcePointsChanged(int index, int count);
+    void handleSourceReset();
+
 Q_SIGNALS:
     void updated();
 
 protected:
-    QVector<QPointF> m_points;
+    // With a capacity set, m_points is used as a ring buffer once it is full:
+    // the logically first point lives at m_ringStart. When m_ringSlotFree is set,
+    // the slot just before m_ringStart has been released and is waiting for the
+    // point that is being appended. linearize() restores the plain layout.
+    mutable QVector<QPointF> m_points;
+    mutable int m_ringStart;
+    mutable bool m_ringSlotFree;
+    int m_capacity;
+    // Set while pointsRemoved() is emitted for the oldest points of a full series that make
+    // room for points being appended, so that the chart can handle both as a single shift
+    bool m_shifting;
+    // Cached result of isSortedByX(), kept up to date by the modifying functions
+    mutable bool m_sortedByXKnown;
+    mutable bool m_sortedByX;
+    // When set, the points are read from the data source and m_points is empty
+    QPointer<QXYDataSource> m_dataSource;
+    // Blocks of data source points read by QXYSeries::at(), which returns references into
+    // them. The blocks are kept until the points of the data source change.
+    mutable QHash<int, QVector<QPointF> > m_sourceBlocks;
+    mutable QMutex m_sourceBlocksMutex;
+    // Summary of the points for min/max decimation, built on first use
+    mutable XYMinMaxPyramid m_minMaxPyramid;
     QPen m_pen;
     QBrush m_brush;
     bool m_pointsVisible;
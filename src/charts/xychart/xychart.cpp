@@ -34,10 +34,13 @@
 #include <private/abstractdomain_p.h>
 #include <private/chartdataset_p.h>
 #include <private/glxyseriesdata_p.h>
+#include <private/xydecimator_p.h>
 #include <QtCharts/QXYModelMapper>
 #include <private/qabstractaxis_p.h>
 #include <QtGui/QPainter>
 #include <QtCore/QAbstractItemModel>
+#include <QtCore/QtMath>
+#include <limits>
 
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -46,11 +49,15 @@ XYChart::XYChart(QXYSeries *series, QGraphicsItem *item):
       ChartItem(series->d_func(),item),
       m_series(series),
       m_animation(0),
-      m_dirty(true)
+      m_dirty(true),
+      m_partialGeometry(false),
+      m_geometryOffset(0),
+      m_shiftedPoints(0)
 {
     QObject::connect(series, SIGNAL(pointReplaced(int)), this, SLOT(handlePointReplaced(int)));
     QObject::connect(series, SIGNAL(pointsReplaced()), this, SLOT(handlePointsReplaced()));
     QObject::connect(series, SIGNAL(pointAdded(int)), this, SLOT(handlePointAdded(int)));
+    QObject::connect(series, SIGNAL(pointsAdded(int, int)), this, SLOT(handlePointsAdded(int, int)));
     QObject::connect(series, SIGNAL(pointRemoved(int)), this, SLOT(handlePointRemoved(int)));
     QObject::connect(series, SIGNAL(pointsRemoved(int, int)), this, SLOT(handlePointsRemoved(int, int)));
     QObject::connect(this, SIGNAL(clicked(QPointF)), series, SIGNAL(clicked(QPointF)));
@@ -60,6 +67,10 @@ XYChart::XYChart(QXYSeries *series, QGraphicsItem *item):
     QObject::connect(this, SIGNAL(doubleClicked(QPointF)), series, SIGNAL(doubleClicked(QPointF)));
     QObject::connect(series, &QAbstractSeries::useOpenGLChanged,
                      this, &XYChart::handleDomainUpdated);
+    if (QLineSeries *lineSeries = qobject_cast<QLineSeries *>(series)) {
+        QObject::connect(lineSeries, &QLineSeries::decimationModeChanged,
+                         this, &XYChart::handleDomainUpdated);
+    }
 }
 
 void XYChart::setGeometryPoints(const QVector<QPointF> &points)
@@ -72,6 +83,17 @@ void XYChart::setAnimation(XYAnimation *animation)
     m_animation = animation;
 }
 
+// Returns true if changes to the series are animated. Interpolating the geometry of a large
+// series on every frame costs more than the animation is worth, so series with more points than
+// the animation point limit of the chart are updated without animation.
+bool XYChart::animationEnabled() const
+{
+    if (!m_animation)
+        return false;
+    const int limit = presenter() ? presenter()->animationPointLimit() : 0;
+    return limit <= 0 || m_series->count() <= limit;
+}
+
 void XYChart::setDirty(bool dirty)
 {
     m_dirty = dirty;
@@ -94,7 +116,7 @@ QVector<bool> XYChart::offGridStatusVector()
     const int seriesLastIndex = m_series->count() - 1;
 
     for (int i = 0; i < m_points.size(); i++) {
-        const QPointF &seriesPoint = m_series->at(qMin(seriesLastIndex, i));
+        const QPointF seriesPoint = m_series->d_func()->pointAt(qMin(seriesLastIndex, i));
         if (seriesPoint.x() < minX
             || seriesPoint.x() > maxX
             || seriesPoint.y() < minY
@@ -107,27 +129,319 @@ QVector<bool> XYChart::offGridStatusVector()
     return returnVector;
 }
 
+// Returns the decimation mode that is in effect for the series. Decimated geometry points do not
+// map one-to-one to the series points, which point markers, point labels and the off-grid
+// handling of polar charts rely on, so decimation is not applied in those cases.
+QLineSeries::DecimationMode XYChart::decimationMode() const
+{
+    const QLineSeries *lineSeries = qobject_cast<const QLineSeries *>(m_series);
+    if (!lineSeries || lineSeries->decimationMode() == QLineSeries::NoDecimation)
+        return QLineSeries::NoDecimation;
+    if (m_series->pointsVisible() || m_series->pointLabelsVisible())
+        return QLineSeries::NoDecimation;
+    if (!presenter() || presenter()->chartType() == QChart::ChartTypePolar)
+        return QLineSeries::NoDecimation;
+    return lineSeries->decimationMode();
+}
+
+// Returns true if the points outside the visible x range can be left out of the geometry.
+// Like decimated points, culled geometry points do not map one-to-one to the series points,
+// which point labels, animations and the off-grid handling of polar charts rely on. Splines
+// decide for themselves, as their control points can depend on all the points of the series.
+bool XYChart::cullingEnabled() const
+{
+    if (m_series->type() != QAbstractSeries::SeriesTypeLine)
+        return false;
+    if (m_series->pointLabelsVisible() || animationEnabled())
+        return false;
+    if (!presenter() || presenter()->chartType() == QChart::ChartTypePolar)
+        return false;
+    return true;
+}
+
+// Returns true if the geometry points cannot be updated point by point, because they are
+// not up to date or do not map one-to-one to the series points.
+bool XYChart::geometryNeedsRecalculation() const
+{
+    return m_dirty || m_points.isEmpty() || m_partialGeometry
+            || decimationMode() != QLineSeries::NoDecimation;
+}
+
+// Calculates the geometry points for the series. If the x values of the series are in
+// ascending order, only the visible range (plus a neighbour on each side) is mapped to
+// geometry. If decimation is in effect, the visible range is also reduced to the resolution
+// of the plot area before the points are mapped to geometry. Points of a series with a data
+// source, or stored as a ring buffer, are only read for the visible range.
+QVector<QPointF> XYChart::calculateGeometryPoints()
+{
+    const QXYSeriesPrivate *series = m_series->d_func();
+    const QLineSeries::DecimationMode mode = decimationMode();
+    m_partialGeometry = false;
+    m_geometryOffset = 0;
+    m_geometryIndices.clear();
+    if ((mode == QLineSeries::NoDecimation && !cullingEnabled()) || !series->isSortedByX())
+        return domain()->calculateGeometryPoints(series->pointsRange(0, m_series->count()));
+
+    // points holds the series points from pointsOffset on
+    QVector<QPointF> points;
+    int pointsOffset = 0;
+    int first = 0;
+    int last = 0;
+    const QXYDataSource *source = series->dataSource();
+    const bool readVisible = source || !series->isLinear();
+    if (source) {
+        XYDecimator::visibleRange(source, domain()->minX(), domain()->maxX(), first, last);
+    } else if (readVisible) {
+        XYDecimator::visibleRange(m_series, domain()->minX(), domain()->maxX(), first, last);
+    } else {
+        points = m_series->pointsVector();
+        XYDecimator::visibleRange(points, domain()->minX(), domain()->maxX(), first, last);
+    }
+    if (m_series->type() == QAbstractSeries::SeriesTypeSpline) {
+        // The segments crossing the edges of the plot area are shaped by one more point
+        first = qMax(0, first - 1);
+        last = qMin(m_series->count(), last + 1);
+    }
+    m_partialGeometry = first > 0 || last < m_series->count();
+
+    const int columns = qCeil(domain()->size().width());
+    const int threshold = (mode == QLineSeries::MinMaxDecimation) ? 4 * columns : columns;
+    if (mode == QLineSeries::NoDecimation || columns <= 0 || last - first <= threshold) {
+        m_geometryOffset = first;
+        if (readVisible)
+            return domain()->calculateGeometryPoints(series->pointsRange(first, last - first));
+        return domain()->calculateGeometryPoints(points.mid(first, last - first));
+    }
+
+    m_partialGeometry = true;
+    const QVector<qreal> edges = (mode == QLineSeries::MinMaxDecimation)
+            ? XYDecimator::columnEdges(domain()) : QVector<qreal>();
+    if (mode == QLineSeries::MinMaxDecimation
+            && last - first >= columns * XYMinMaxPyramid::BaseBucketSize) {
+        // Large data sets are first reduced to the extrema of the buckets of their min/max
+        // summary that lie within a single pixel column, and only those points are read and
+        // decimated per column
+        const XYMinMaxPyramid *pyramid = series->minMaxPyramid();
+        const QVector<int> candidates = pyramid->minMax(first, last, edges);
+        QVector<QPointF> candidatePoints;
+        candidatePoints.reserve(candidates.size());
+        for (int index : candidates)
+            candidatePoints.append(readVisible ? series->pointAt(index) : points.at(index));
+        m_geometryIndices = XYDecimator::minMax(candidatePoints, 0, candidatePoints.size(), edges);
+
+        QVector<QPointF> decimatedPoints;
+        decimatedPoints.reserve(m_geometryIndices.size());
+        for (int &index : m_geometryIndices) {
+            decimatedPoints.append(candidatePoints.at(index));
+            index = candidates.at(index);
+        }
+        return domain()->calculateGeometryPoints(decimatedPoints);
+    }
+
+    if (readVisible) {
+        points = series->pointsRange(first, last - first);
+        pointsOffset = first;
+        first = 0;
+        last = points.size();
+    }
+    if (mode == QLineSeries::MinMaxDecimation)
+        m_geometryIndices = XYDecimator::minMax(points, first, last, edges);
+    else
+        m_geometryIndices = XYDecimator::lttb(points, first, last, columns);
+
+    QVector<QPointF> decimatedPoints;
+    decimatedPoints.reserve(m_geometryIndices.size());
+    for (int &index : m_geometryIndices) {
+        decimatedPoints.append(points.at(index));
+        index += pointsOffset;
+    }
+    return domain()->calculateGeometryPoints(decimatedPoints);
+}
+
+// Returns the index of the series point the geometry point at geometryIndex was mapped from
+int XYChart::seriesIndex(int geometryIndex) const
+{
+    if (geometryIndex < 0 || m_series->count() == 0)
+        return -1;
+    if (!m_geometryIndices.isEmpty())
+        return m_geometryIndices.value(geometryIndex, -1);
+    // During a remove animation the geometry can have more points than the series
+    return qMin(m_geometryOffset + geometryIndex, m_series->count() - 1);
+}
+
+// Returns the index of the geometry point closest to the position, or -1 if there is none within
+// maxDistance. A negative maxDistance does not limit the distance. The spatial index is built
+// on the first query after the geometry has changed; it shares the geometry vector, so any change
+// to the geometry detaches it and is noticed.
+int XYChart::nearestGeometryPoint(const QPointF &position, qreal maxDistance,
+                                  XYPointIndex::Metric metric, qreal *distance)
+{
+    if (m_series->useOpenGL() && m_glGeometryPoints.isEmpty()) {
+        // OpenGL series do not keep geometry points of their own
+        m_glGeometryPoints = domain()->calculateGeometryPoints(m_series->pointsVector());
+    }
+    const QVector<QPointF> &points = m_series->useOpenGL() ? m_glGeometryPoints : m_points;
+    if (!m_pointIndex.isBuiltFor(points))
+        m_pointIndex.build(points, QRectF(QPointF(0, 0), domain()->size()));
+
+    if (maxDistance < 0)
+        maxDistance = std::numeric_limits<qreal>::infinity();
+    const int index = m_pointIndex.nearest(position, maxDistance, metric);
+    if (distance && index >= 0) {
+        const QPointF delta = points.at(index) - position;
+        *distance = (metric == XYPointIndex::ChebyshevMetric)
+                ? qMax(qAbs(delta.x()), qAbs(delta.y()))
+                : qSqrt(delta.x() * delta.x() + delta.y() * delta.y());
+    }
+    return index;
+}
+
+// Returns the index of the series point closest to the position, see nearestGeometryPoint()
+int XYChart::nearestPoint(const QPointF &position, qreal maxDistance, qreal *distance)
+{
+    return seriesIndex(nearestGeometryPoint(position, maxDistance,
+                                            XYPointIndex::EuclideanMetric, distance));
+}
+
 void XYChart::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index)
 {
 
-    if (m_animation) {
+    if (animationEnabled()) {
         m_animation->setup(oldPoints, newPoints, index);
         m_points = newPoints;
         setDirty(false);
         presenter()->startAnimation(m_animation);
     } else {
-        m_points = newPoints;
+        if (m_animation && m_animation->state() != QAbstractAnimation::Stopped) {
+            // Stopping may still set the geometry points, which newPoints can refer to
+            QVector<QPointF> points = newPoints;
+            m_animation->stop();
+            m_points = points;
+        } else {
+            m_points = newPoints;
+        }
+        // The geometry points are up to date, so following changes can be applied to them
+        // point by point
+        setDirty(false);
         updateGeometry();
     }
 }
 
+// Forgets the points removed for a shift that is interrupted by another change. The removal
+// has not been applied to the geometry, so it is calculated again.
+void XYChart::cancelShift()
+{
+    if (m_shiftedPoints) {
+        m_shiftedPoints = 0;
+        setDirty(true);
+    }
+}
+
+// Defers the geometry update to the next update pass of the presenter, if the chart defers its
+// updates. Returns false if the geometry needs to be updated right away.
+bool XYChart::deferUpdate()
+{
+    return presenter() && presenter()->scheduleUpdate(this);
+}
+
+// Updates the geometry once for all the changes made since the update was deferred
+void XYChart::handleScheduledUpdate()
+{
+    cancelShift();
+    if (m_series->useOpenGL()) {
+        updateGlChart();
+    } else {
+        if (isEmpty() && m_points.isEmpty())
+            return;
+        QVector<QPointF> points = calculateGeometryPoints();
+        updateChart(m_points, points);
+    }
+}
+
 void XYChart::updateGlChart()
 {
+    m_glGeometryPoints.clear();
     dataSet()->glXYSeriesDataManager()->setPoints(m_series, domain());
     presenter()->updateGLWidget();
     updateGeometry();
 }
 
+// Like updateGlChart(), but only count points at index have been appended or replaced, so only
+// they are stored and uploaded again.
+void XYChart::updateGlPoints(int index, int count)
+{
+    m_glGeometryPoints.clear();
+    dataSet()->glXYSeriesDataManager()->updatePoints(m_series, domain(), index, count);
+    presenter()->updateGLWidget();
+    updateGeometry();
+}
+
+// Like updateGlChart(), but the removed oldest points have made room for count appended points,
+// so only the appended points are stored and uploaded.
+void XYChart::updateGlShifted(int removed, int count)
+{
+    m_glGeometryPoints.clear();
+    dataSet()->glXYSeriesDataManager()->shiftPoints(m_series, domain(), removed, count);
+    presenter()->updateGLWidget();
+    updateGeometry();
+}
+
+// Like updateGlChart(), but only the visible range has changed, so the points are kept as
+// they are and only their transformation to the plot area is updated.
+void XYChart::updateGlDomain()
+{
+    m_glGeometryPoints.clear();
+    dataSet()->glXYSeriesDataManager()->setDomain(m_series, domain());
+    presenter()->updateGLWidget();
+    updateGeometry();
+}
+
+// Called after points have been appended to the geometry points without animation.
+// The default implementation goes through the normal update path, items that can extend
+// their geometry incrementally reimplement this.
+void XYChart::updateGeometryAppended(int index, int count)
+{
+    Q_UNUSED(count);
+
+    QVector<QPointF> points = m_points;
+    updateChart(m_points, points, index);
+}
+
+// Called after the removed oldest geometry points have been dropped and count points have
+// been appended to the geometry points without animation. Like updateGeometryAppended(), the
+// default implementation goes through the normal update path.
+void XYChart::updateGeometryShifted(int removed, int count)
+{
+    Q_UNUSED(removed);
+    Q_UNUSED(count);
+
+    QVector<QPointF> points = m_points;
+    updateChart(m_points, points);
+}
+
+// Handles the oldest removed points of a full series together with the count points that were
+// appended at index to take their place, so that a sliding window is updated in one step
+void XYChart::handlePointsShifted(int removed, int index, int count)
+{
+    if (m_series->useOpenGL()) {
+        updateGlShifted(removed, count);
+        return;
+    }
+
+    if (!geometryNeedsRecalculation() && m_points.size() == index + removed) {
+        const QVector<QPointF> addedPoints =
+                domain()->calculateGeometryPoints(m_series->d_func()->pointsRange(index, count));
+        if (addedPoints.size() == count) {
+            m_points.remove(0, removed);
+            m_points.append(addedPoints);
+            updateGeometryShifted(removed, count);
+            return;
+        }
+    }
+    QVector<QPointF> points = calculateGeometryPoints();
+    updateChart(m_points, points);
+}
+
 // Doesn't update gl geometry, but refreshes the chart
 void XYChart::refreshGlChart()
 {
@@ -142,16 +456,34 @@ void XYChart::handlePointAdded(int index)
     Q_ASSERT(index < m_series->count());
     Q_ASSERT(index >= 0);
 
+    if (deferUpdate())
+        return;
+
+    if (m_shiftedPoints && index == m_series->count() - 1) {
+        const int removed = m_shiftedPoints;
+        m_shiftedPoints = 0;
+        handlePointsShifted(removed, index, 1);
+        return;
+    }
+    cancelShift();
+
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        updateGlPoints(index, 1);
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (geometryNeedsRecalculation()) {
+            points = calculateGeometryPoints();
         } else {
-            points = m_points;
-            QPointF point = domain()->calculateGeometryPoint(m_series->pointsVector().at(index),
+            QPointF point = domain()->calculateGeometryPoint(m_series->d_func()->pointAt(index),
                                                              m_validData);
+            if (m_validData && !animationEnabled() && index == m_points.size()) {
+                // Point was appended, so the existing geometry can be extended in place
+                // instead of being copied.
+                m_points.append(point);
+                updateGeometryAppended(index, 1);
+                return;
+            }
+            points = m_points;
             if (!m_validData)
                 m_points.clear();
             else
@@ -161,17 +493,63 @@ void XYChart::handlePointAdded(int index)
     }
 }
 
+void XYChart::handlePointsAdded(int index, int count)
+{
+    Q_ASSERT(index >= 0);
+    Q_ASSERT(index + count <= m_series->count());
+
+    if (deferUpdate())
+        return;
+
+    if (m_shiftedPoints && index + count == m_series->count()) {
+        const int removed = m_shiftedPoints;
+        m_shiftedPoints = 0;
+        handlePointsShifted(removed, index, count);
+        return;
+    }
+    cancelShift();
+
+    if (m_series->useOpenGL()) {
+        updateGlPoints(index, count);
+    } else {
+        QVector<QPointF> points;
+        if (geometryNeedsRecalculation()) {
+            points = calculateGeometryPoints();
+        } else {
+            // Map only the added block, the rest of the geometry is still valid
+            const QVector<QPointF> addedPoints =
+                    domain()->calculateGeometryPoints(m_series->d_func()->pointsRange(index, count));
+            if (addedPoints.size() != count) {
+                points = calculateGeometryPoints();
+            } else if (!animationEnabled() && index == m_points.size()) {
+                m_points.append(addedPoints);
+                updateGeometryAppended(index, count);
+                return;
+            } else {
+                points = m_points.mid(0, index);
+                points.append(addedPoints);
+                points.append(m_points.mid(index));
+            }
+        }
+        updateChart(m_points, points, index);
+    }
+}
+
 void XYChart::handlePointRemoved(int index)
 {
     Q_ASSERT(index <= m_series->count());
     Q_ASSERT(index >= 0);
 
+    if (deferUpdate())
+        return;
+    cancelShift();
+
     if (m_series->useOpenGL()) {
         updateGlChart();
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (geometryNeedsRecalculation()) {
+            points = calculateGeometryPoints();
         } else {
             points = m_points;
             points.remove(index);
@@ -185,12 +563,28 @@ void XYChart::handlePointsRemoved(int index, int count)
     Q_ASSERT(index <= m_series->count());
     Q_ASSERT(index >= 0);
 
+    if (deferUpdate())
+        return;
+
+    if (index == 0 && m_series->d_func()->isShifting() && !animationEnabled()) {
+        // The oldest points of a full series make room for points that are being appended,
+        // the geometry is updated once they have been added
+        m_shiftedPoints += count;
+        return;
+    }
+    cancelShift();
+
     if (m_series->useOpenGL()) {
         updateGlChart();
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (geometryNeedsRecalculation()) {
+            points = calculateGeometryPoints();
+        } else if (!animationEnabled()) {
+            // Drop the removed geometry in place instead of copying the whole geometry
+            m_points.remove(index, count);
+            updateChart(m_points, m_points, index);
+            return;
         } else {
             points = m_points;
             points.remove(index, count);
@@ -204,14 +598,18 @@ void XYChart::handlePointReplaced(int index)
     Q_ASSERT(index < m_series->count());
     Q_ASSERT(index >= 0);
 
+    if (deferUpdate())
+        return;
+    cancelShift();
+
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        updateGlPoints(index, 1);
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (geometryNeedsRecalculation()) {
+            points = calculateGeometryPoints();
         } else {
-            QPointF point = domain()->calculateGeometryPoint(m_series->pointsVector().at(index),
+            QPointF point = domain()->calculateGeometryPoint(m_series->d_func()->pointAt(index),
                                                              m_validData);
             if (!m_validData)
                 m_points.clear();
@@ -225,29 +623,37 @@ void XYChart::handlePointReplaced(int index)
 
 void XYChart::handlePointsReplaced()
 {
+    if (deferUpdate())
+        return;
+    cancelShift();
+
     if (m_series->useOpenGL()) {
         updateGlChart();
     } else {
         // All the points were replaced -> recalculate
-        QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        QVector<QPointF> points = calculateGeometryPoints();
         updateChart(m_points, points, -1);
     }
 }
 
 void XYChart::handleDomainUpdated()
 {
+    if (deferUpdate())
+        return;
+    cancelShift();
+
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        updateGlDomain();
     } else {
         if (isEmpty()) return;
-        QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        QVector<QPointF> points = calculateGeometryPoints();
         updateChart(m_points, points);
     }
 }
 
 bool XYChart::isEmpty()
 {
-    return domain()->isEmpty() || m_series->points().isEmpty();
+    return domain()->isEmpty() || m_series->count() == 0;
 }
 
 QT_CHARTS_END_NAMESPACE
@@ -3,19 +3,28 @@ INCLUDEPATH += $$PWD
 SOURCES += \
     $$PWD/xychart.cpp \
     $$PWD/qxyseries.cpp \
+    $$PWD/qxydatasource.cpp \
     $$PWD/qxymodelmapper.cpp \
     $$PWD/qvxymodelmapper.cpp \
     $$PWD/qhxymodelmapper.cpp  \
-    $$PWD/glxyseriesdata.cpp
+    $$PWD/glxyseriesdata.cpp \
+    $$PWD/xydecimator.cpp \
+    $$PWD/xyminmaxpyramid.cpp \
+    $$PWD/xypointindex.cpp
 
 PRIVATE_HEADERS += \
     $$PWD/xychart_p.h \
     $$PWD/qxyseries_p.h \
+    $$PWD/qxydatasource_p.h \
     $$PWD/qxymodelmapper_p.h \
-    $$PWD/glxyseriesdata_p.h
+    $$PWD/glxyseriesdata_p.h \
+    $$PWD/xydecimator_p.h \
+    $$PWD/xyminmaxpyramid_p.h \
+    $$PWD/xypointindex_p.h
 
 PUBLIC_HEADERS += \
     $$PWD/qxyseries.h \
+    $$PWD/qxydatasource.h \
     $$PWD/qxymodelmapper.h \
     $$PWD/qvxymodelmapper.h \
     $$PWD/qhxymodelmapper.h
@@ -42,7 +42,9 @@
 #include <QtCharts/QChartGlobal>
 #include <private/chartitem_p.h>
 #include <private/xyanimation_p.h>
+#include <private/xypointindex_p.h>
 #include <QtCharts/QValueAxis>
+#include <QtCharts/QLineSeries>
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtGui/QPen>
 
@@ -59,10 +61,12 @@ public:
     ~XYChart() {}
 
     void setGeometryPoints(const QVector<QPointF> &points);
+    void swapGeometryPoints(QVector<QPointF> &points) { m_points.swap(points); }
     QVector<QPointF> geometryPoints() const { return m_points; }
 
     void setAnimation(XYAnimation *animation);
     ChartAnimation *animation() const { return m_animation; }
+    bool animationEnabled() const;
     virtual void updateGeometry() = 0;
 
     bool isDirty() const { return m_dirty; }
@@ -71,8 +75,17 @@ public:
     void getSeriesRanges(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY);
     QVector<bool> offGridStatusVector();
 
+    int nearestGeometryPoint(const QPointF &position, qreal maxDistance,
+                             XYPointIndex::Metric metric = XYPointIndex::EuclideanMetric,
+                             qreal *distance = nullptr);
+    int nearestPoint(const QPointF &position, qreal maxDistance, qreal *distance = nullptr);
+    int seriesIndex(int geometryIndex) const;
+
+    void handleScheduledUpdate();
+
 public Q_SLOTS:
     void handlePointAdded(int index);
+    void handlePointsAdded(int index, int count);
     void handlePointRemoved(int index);
     void handlePointsRemoved(int index, int count);
     void handlePointReplaced(int index);
@@ -87,18 +100,42 @@ Q_SIGNALS:
     void doubleClicked(const QPointF &point);
 
 protected:
+    QVector<QPointF> calculateGeometryPoints();
+    QLineSeries::DecimationMode decimationMode() const;
+    virtual bool cullingEnabled() const;
+    bool geometryNeedsRecalculation() const;
+    bool deferUpdate();
+
     virtual void updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index = -1);
+    virtual void updateGeometryAppended(int index, int count);
+    virtual void updateGeometryShifted(int removed, int count);
     virtual void updateGlChart();
+    void updateGlPoints(int index, int count);
+    void updateGlShifted(int removed, int count);
+    void updateGlDomain();
     virtual void refreshGlChart();
 
 private:
     inline bool isEmpty();
+    void handlePointsShifted(int removed, int index, int count);
+    void cancelShift();
 
 protected:
     QXYSeries *m_series;
     QVector<QPointF> m_points;
     XYAnimation *m_animation;
     bool m_dirty;
+    // Set when the geometry points cover only part of the series (culled or decimated). Culled
+    // geometry starts at series index m_geometryOffset, decimated geometry maps to the series
+    // indexes in m_geometryIndices.
+    bool m_partialGeometry;
+    int m_geometryOffset;
+    QVector<int> m_geometryIndices;
+    XYPointIndex m_pointIndex;
+    QVector<QPointF> m_glGeometryPoints;
+    // Number of removed oldest points whose removal is applied together with the points
+    // appended to take their place, see handlePointsShifted()
+    int m_shiftedPoints;
 
     friend class AreaChartItem;
 };
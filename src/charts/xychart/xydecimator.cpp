@@ -0,0 +1,263 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/xydecimator_p.h>
+#include <private/abstractdomain_p.h>
+#include <QtCharts/QXYDataSource>
+#include <QtCharts/QXYSeries>
+#include <QtCore/QtMath>
+#include <algorithm>
+#include <limits>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+bool XYDecimator::isSortedByX(const QVector<QPointF> &points)
+{
+    for (int i = 1; i < points.size(); ++i) {
+        if (points.at(i).x() < points.at(i - 1).x())
+            return false;
+    }
+    return true;
+}
+
+bool XYDecimator::isSortedByX(const QXYDataSource *source)
+{
+    // Read the points in blocks instead of copying all of them
+    const int count = source->count();
+    const int blockSize = 4096;
+    QVector<QPointF> block(qMin(blockSize, count));
+    qreal previousX = -std::numeric_limits<qreal>::infinity();
+    for (int start = 0; start < count; start += blockSize) {
+        const int size = qMin(blockSize, count - start);
+        source->readPoints(start, size, block.data());
+        for (int i = 0; i < size; ++i) {
+            const qreal x = block.at(i).x();
+            if (x < previousX)
+                return false;
+            previousX = x;
+        }
+    }
+    return true;
+}
+
+// Finds the half-open index range [first, last) of the points that fall inside the given x range.
+// One neighbour on each side is included so that lines entering and leaving the plot area
+// are drawn correctly.
+void XYDecimator::visibleRange(const QVector<QPointF> &points, qreal minX, qreal maxX,
+                               int &first, int &last)
+{
+    auto lower = std::lower_bound(points.cbegin(), points.cend(), minX,
+                                  [](const QPointF &point, qreal x) { return point.x() < x; });
+    auto upper = std::upper_bound(lower, points.cend(), maxX,
+                                  [](qreal x, const QPointF &point) { return x < point.x(); });
+    first = qMax(0, int(lower - points.cbegin()) - 1);
+    last = qMin(int(points.size()), int(upper - points.cbegin()) + 1);
+}
+
+// Same as above for points that are looked up one by one with at()
+template <typename Points>
+static void findVisibleRange(const Points *source, qreal minX, qreal maxX, int &first, int &last)
+{
+    const int count = source->count();
+    int lower = 0;
+    int size = count;
+    while (size > 0) {
+        const int half = size / 2;
+        if (source->at(lower + half).x() < minX) {
+            lower += half + 1;
+            size -= half + 1;
+        } else {
+            size = half;
+        }
+    }
+    int upper = lower;
+    size = count - lower;
+    while (size > 0) {
+        const int half = size / 2;
+        if (!(maxX < source->at(upper + half).x())) {
+            upper += half + 1;
+            size -= half + 1;
+        } else {
+            size = half;
+        }
+    }
+    first = qMax(0, lower - 1);
+    last = qMin(count, upper + 1);
+}
+
+void XYDecimator::visibleRange(const QXYDataSource *source, qreal minX, qreal maxX,
+                               int &first, int &last)
+{
+    findVisibleRange(source, minX, maxX, first, last);
+}
+
+// For series points that are not stored in order, such as a full series with a capacity
+void XYDecimator::visibleRange(const QXYSeries *series, qreal minX, qreal maxX,
+                               int &first, int &last)
+{
+    findVisibleRange(series, minX, maxX, first, last);
+}
+
+// Returns the x values of the pixel column boundaries of the domain in ascending order.
+// The domain does the mapping, so logarithmic and reversed axes get correct columns.
+QVector<qreal> XYDecimator::columnEdges(const AbstractDomain *domain)
+{
+    const int columns = qCeil(domain->size().width());
+    QVector<qreal> edges;
+    if (columns <= 0)
+        return edges;
+
+    edges.resize(columns + 1);
+    for (int i = 0; i <= columns; ++i)
+        edges[i] = domain->calculateDomainPoint(QPointF(i, 0)).x();
+    if (edges.first() > edges.last())
+        std::reverse(edges.begin(), edges.end());
+    return edges;
+}
+
+// Keeps the first, the lowest, the highest and the last point of each pixel column. This
+// rasterizes to the same pixels as the full data while producing at most four points per column.
+// Returns the indexes of the kept points in ascending order.
+QVector<int> XYDecimator::minMax(const QVector<QPointF> &points, int first, int last,
+                                 const QVector<qreal> &edges)
+{
+    QVector<int> result;
+    if (edges.size() < 2) {
+        for (int i = first; i < last; ++i)
+            result.append(i);
+        return result;
+    }
+    result.reserve(4 * edges.size() + 2);
+
+    const int lastColumn = edges.size() - 2;
+    int i = first;
+
+    // Points left of the plot area are not bucketed
+    while (i < last && points.at(i).x() < edges.first())
+        result.append(i++);
+
+    int column = 0;
+    while (i < last && points.at(i).x() <= edges.last()) {
+        while (column < lastColumn && points.at(i).x() >= edges.at(column + 1))
+            ++column;
+        const qreal columnEnd = edges.at(column + 1);
+
+        const int firstIndex = i;
+        int minIndex = i;
+        int maxIndex = i;
+        for (++i; i < last; ++i) {
+            const qreal x = points.at(i).x();
+            if (column < lastColumn ? x >= columnEnd : x > columnEnd)
+                break;
+            const qreal y = points.at(i).y();
+            if (y < points.at(minIndex).y())
+                minIndex = i;
+            else if (y > points.at(maxIndex).y())
+                maxIndex = i;
+        }
+        const int lastIndex = i - 1;
+
+        const int indices[4] = { firstIndex, qMin(minIndex, maxIndex), qMax(minIndex, maxIndex),
+                                 lastIndex };
+        int previous = -1;
+        for (int index : indices) {
+            if (index != previous)
+                result.append(index);
+            previous = index;
+        }
+    }
+
+    // Points right of the plot area are not bucketed either
+    while (i < last)
+        result.append(i++);
+
+    return result;
+}
+
+// Largest-Triangle-Three-Buckets downsampling (Sveinn Steinarsson, 2013). Keeps the first and
+// the last point and picks from each bucket in between the point forming the largest triangle
+// with the previously selected point and the average of the next bucket. Returns the indexes of
+// the kept points in ascending order.
+QVector<int> XYDecimator::lttb(const QVector<QPointF> &points, int first, int last,
+                               int threshold)
+{
+    const int count = last - first;
+    QVector<int> result;
+    if (threshold >= count || threshold < 3) {
+        for (int i = first; i < last; ++i)
+            result.append(i);
+        return result;
+    }
+
+    result.reserve(threshold);
+    result.append(first);
+
+    const qreal bucketSize = qreal(count - 2) / (threshold - 2);
+    int selected = first;
+
+    for (int bucket = 0; bucket < threshold - 2; ++bucket) {
+        const int averageStart = first + int((bucket + 1) * bucketSize) + 1;
+        const int averageEnd = qMin(first + int((bucket + 2) * bucketSize) + 1, last);
+        qreal averageX = 0;
+        qreal averageY = 0;
+        if (averageStart < averageEnd) {
+            for (int i = averageStart; i < averageEnd; ++i) {
+                averageX += points.at(i).x();
+                averageY += points.at(i).y();
+            }
+            averageX /= averageEnd - averageStart;
+            averageY /= averageEnd - averageStart;
+        } else {
+            averageX = points.at(last - 1).x();
+            averageY = points.at(last - 1).y();
+        }
+
+        const int rangeStart = first + int(bucket * bucketSize) + 1;
+        const int rangeEnd = qMin(first + int((bucket + 1) * bucketSize) + 1, last - 1);
+        const QPointF &a = points.at(selected);
+        qreal maxArea = -1;
+        int next = rangeStart;
+        for (int i = rangeStart; i < rangeEnd; ++i) {
+            const qreal area = qAbs((a.x() - averageX) * (points.at(i).y() - a.y())
+                                    - (a.x() - points.at(i).x()) * (averageY - a.y()));
+            if (area > maxArea) {
+                maxArea = area;
+                next = i;
+            }
+        }
+        result.append(next);
+        selected = next;
+    }
+
+    result.append(last - 1);
+    return result;
+}
+
+QT_CHARTS_END_NAMESPACE
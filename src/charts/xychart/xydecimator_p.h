@@ -0,0 +1,78 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+
+#ifndef XYDECIMATOR_H
+#define XYDECIMATOR_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointF>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class AbstractDomain;
+class QXYDataSource;
+class QXYSeries;
+
+// Reduces series data to what can be resolved on the plot area. All functions operate on
+// series (domain) coordinates and expect the points to be sorted by ascending x value.
+class Q_CHARTS_PRIVATE_EXPORT XYDecimator
+{
+public:
+    static bool isSortedByX(const QVector<QPointF> &points);
+    static bool isSortedByX(const QXYDataSource *source);
+    static void visibleRange(const QVector<QPointF> &points, qreal minX, qreal maxX,
+                             int &first, int &last);
+    static void visibleRange(const QXYDataSource *source, qreal minX, qreal maxX,
+                             int &first, int &last);
+    static void visibleRange(const QXYSeries *series, qreal minX, qreal maxX,
+                             int &first, int &last);
+    static QVector<qreal> columnEdges(const AbstractDomain *domain);
+
+    static QVector<int> minMax(const QVector<QPointF> &points, int first, int last,
+                               const QVector<qreal> &edges);
+    static QVector<int> lttb(const QVector<QPointF> &points, int first, int last,
+                             int threshold);
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYDECIMATOR_H
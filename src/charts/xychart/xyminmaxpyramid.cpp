@@ -0,0 +1,219 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xyminmaxpyramid_p.h>
+
+#include <algorithm>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+static inline void appendIndex(QVector<int> &result, int index)
+{
+    if (result.isEmpty() || index > result.last())
+        result.append(index);
+}
+
+// Returns the pixel column of x like XYDecimator::minMax() assigns it, -1 for x left of the
+// columns and the number of columns for x right of them
+static int columnOf(const QVector<qreal> &edges, qreal x)
+{
+    const int columns = edges.size() - 1;
+    if (x < edges.first())
+        return -1;
+    if (x > edges.last())
+        return columns;
+    const int column = int(std::upper_bound(edges.cbegin(), edges.cend(), x) - edges.cbegin()) - 1;
+    return qMin(column, columns - 1);
+}
+
+XYMinMaxPyramid::XYMinMaxPyramid()
+    : m_count(0),
+      m_offset(0)
+{
+}
+
+// Returns the number of points covered by a bucket on the level
+qint64 XYMinMaxPyramid::bucketSize(int level) const
+{
+    qint64 size = BaseBucketSize;
+    for (int i = 0; i < level; ++i)
+        size *= BucketFactor;
+    return size;
+}
+
+void XYMinMaxPyramid::clear()
+{
+    m_levels.clear();
+    m_count = 0;
+    m_offset = 0;
+}
+
+// Adds the points following the points summarized so far. Only the last bucket of each level
+// and the buckets after it are updated.
+void XYMinMaxPyramid::append(const QPointF *points, int count)
+{
+    if (count <= 0)
+        return;
+
+    if (m_levels.isEmpty())
+        m_levels.resize(1);
+    int changed = m_count / BaseBucketSize;
+    QVector<Bucket> &base = m_levels[0];
+    for (int i = 0; i < count; ++i) {
+        const int index = m_count + i;
+        const qreal x = points[i].x();
+        const qreal y = points[i].y();
+        if (index % BaseBucketSize == 0) {
+            const Bucket bucket = { x, x, y, y, index, index };
+            base.append(bucket);
+            continue;
+        }
+        Bucket &bucket = base.last();
+        bucket.lastX = x;
+        if (y < bucket.minY) {
+            bucket.minY = y;
+            bucket.minIndex = index;
+        } else if (y > bucket.maxY) {
+            bucket.maxY = y;
+            bucket.maxIndex = index;
+        }
+    }
+    m_count += count;
+
+    // Levels are added until the coarsest one has at most BucketFactor buckets
+    for (int level = 1; m_levels.at(level - 1).size() > BucketFactor; ++level) {
+        if (level == m_levels.size())
+            m_levels.append(QVector<Bucket>());
+        const QVector<Bucket> &finer = m_levels.at(level - 1);
+        QVector<Bucket> &coarser = m_levels[level];
+        changed /= BucketFactor;
+        coarser.resize((finer.size() + BucketFactor - 1) / BucketFactor);
+        for (int i = changed; i < coarser.size(); ++i) {
+            const int end = qMin((i + 1) * BucketFactor, int(finer.size()));
+            Bucket bucket = finer.at(i * BucketFactor);
+            for (int j = i * BucketFactor + 1; j < end; ++j)
+                merge(bucket, finer.at(j));
+            coarser[i] = bucket;
+        }
+    }
+}
+
+// Removes the first count points from the summary. The buckets are kept, and the ranges that are
+// decimated start after the removed points, so the partially removed buckets are read from the
+// finer levels. Once more points have been removed than are left, the summary is cleared so that
+// it does not grow without bounds, and it is built again on next use.
+void XYMinMaxPyramid::removeFirst(int count)
+{
+    m_offset += count;
+    if (m_offset >= m_count - m_offset)
+        clear();
+}
+
+// Reduces the points from first to last (exclusive) to the first, the lowest, the highest and
+// the last point of each pixel column between the edges, like XYDecimator::minMax() does. Each
+// bucket that lies within a single column is represented by its first, lowest, highest and last
+// point, and the buckets crossing a column edge are split into their finer buckets down to the
+// single points. Which buckets are used thus depends on the x range they span rather than on
+// their number of points. The returned indexes are in ascending order, and running
+// XYDecimator::minMax() over their points gives the same points as running it over the whole
+// range.
+QVector<int> XYMinMaxPyramid::minMax(int first, int last, const QVector<qreal> &edges) const
+{
+    Q_ASSERT(last <= count());
+    QVector<int> result;
+    if (first >= last)
+        return result;
+
+    if (edges.size() < 2) {
+        for (int i = first; i < last; ++i)
+            result.append(i);
+        return result;
+    }
+
+    result.reserve(8 * edges.size() + 2 * BaseBucketSize);
+    appendRange(result, first + m_offset, last + m_offset, m_levels.size() - 1, edges);
+    if (m_offset) {
+        for (int &index : result)
+            index -= m_offset;
+    }
+    return result;
+}
+
+void XYMinMaxPyramid::merge(Bucket &bucket, const Bucket &other)
+{
+    bucket.lastX = other.lastX;
+    if (other.minY < bucket.minY) {
+        bucket.minY = other.minY;
+        bucket.minIndex = other.minIndex;
+    }
+    if (other.maxY > bucket.maxY) {
+        bucket.maxY = other.maxY;
+        bucket.maxIndex = other.maxIndex;
+    }
+}
+
+void XYMinMaxPyramid::appendRange(QVector<int> &result, int first, int last, int level,
+                                  const QVector<qreal> &edges) const
+{
+    if (first >= last)
+        return;
+
+    if (level < 0) {
+        for (int i = first; i < last; ++i)
+            appendIndex(result, i);
+        return;
+    }
+
+    const qint64 size = bucketSize(level);
+    const int begin = int((first + size - 1) / size);
+    const int end = int(last / size);
+    if (begin >= end) {
+        appendRange(result, first, last, level - 1, edges);
+        return;
+    }
+
+    appendRange(result, first, int(begin * size), level - 1, edges);
+    const int columns = edges.size() - 1;
+    const QVector<Bucket> &buckets = m_levels.at(level);
+    for (int i = begin; i < end; ++i) {
+        const Bucket &bucket = buckets.at(i);
+        const int column = columnOf(edges, bucket.firstX);
+        if (column < 0 || column >= columns || columnOf(edges, bucket.lastX) != column) {
+            appendRange(result, int(i * size), int((i + 1) * size), level - 1, edges);
+            continue;
+        }
+        appendIndex(result, int(i * size));
+        appendIndex(result, qMin(bucket.minIndex, bucket.maxIndex));
+        appendIndex(result, qMax(bucket.minIndex, bucket.maxIndex));
+        appendIndex(result, int((i + 1) * size - 1));
+    }
+    appendRange(result, int(end * size), last, level - 1, edges);
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,99 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+
+#ifndef XYMINMAXPYRAMID_H
+#define XYMINMAXPYRAMID_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointF>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Summarizes consecutive points sorted by x in levels of buckets. A bucket on level 0 covers
+// BaseBucketSize points, and a bucket on each following level covers BucketFactor buckets of
+// the previous level. Each bucket keeps the x range it spans and the indexes of its lowest and
+// its highest point, so that the points of each pixel column can be reduced to their extrema
+// without reading them. Appended points extend the summary incrementally, and points removed
+// from the front are skipped by offsetting the indexes instead of rebuilding it.
+class Q_CHARTS_PRIVATE_EXPORT XYMinMaxPyramid
+{
+public:
+    enum {
+        BaseBucketSize = 64,
+        BucketFactor = 4
+    };
+
+    XYMinMaxPyramid();
+
+    int count() const { return m_count - m_offset; }
+    int levelCount() const { return m_levels.size(); }
+    qint64 bucketSize(int level) const;
+
+    void clear();
+    void append(const QPointF *points, int count);
+    void removeFirst(int count);
+
+    QVector<int> minMax(int first, int last, const QVector<qreal> &edges) const;
+
+private:
+    struct Bucket
+    {
+        qreal firstX;
+        qreal lastX;
+        qreal minY;
+        qreal maxY;
+        int minIndex;
+        int maxIndex;
+    };
+
+    static void merge(Bucket &bucket, const Bucket &other);
+    void appendRange(QVector<int> &result, int first, int last, int level,
+                     const QVector<qreal> &edges) const;
+
+    QVector<QVector<Bucket> > m_levels;
+    // Indexes in the buckets count from the first point ever appended, m_offset of which have
+    // been removed since
+    int m_count;
+    int m_offset;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYMINMAXPYRAMID_H
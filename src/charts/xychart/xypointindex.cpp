@@ -0,0 +1,144 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/xypointindex_p.h>
+#include <QtCore/QtMath>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+XYPointIndex::XYPointIndex()
+    : m_cellSize(1.0),
+      m_columns(0),
+      m_rows(0)
+{
+}
+
+// Builds the index for the points. The grid covers the rectangle with cells of about two
+// points each. The points are sorted into the cells with a counting sort, so building is O(n).
+void XYPointIndex::build(const QVector<QPointF> &points, const QRectF &rect)
+{
+    clear();
+    if (points.isEmpty() || rect.width() <= 0 || rect.height() <= 0)
+        return;
+
+    m_points = points;
+    m_rect = rect;
+    m_cellSize = qMax(qSqrt(rect.width() * rect.height() * 2 / points.size()), qreal(1.0));
+    m_columns = qMax(1, qCeil(rect.width() / m_cellSize));
+    m_rows = qMax(1, qCeil(rect.height() / m_cellSize));
+
+    QVector<int> cells(points.size());
+    m_cellStart.fill(0, m_columns * m_rows + 1);
+    for (int i = 0; i < points.size(); ++i) {
+        cells[i] = row(points.at(i).y()) * m_columns + column(points.at(i).x());
+        ++m_cellStart[cells[i] + 1];
+    }
+    for (int i = 1; i < m_cellStart.size(); ++i)
+        m_cellStart[i] += m_cellStart[i - 1];
+
+    QVector<int> next = m_cellStart;
+    m_cellPoints.resize(points.size());
+    for (int i = 0; i < points.size(); ++i)
+        m_cellPoints[next[cells[i]]++] = i;
+}
+
+void XYPointIndex::clear()
+{
+    m_points.clear();
+    m_cellStart.clear();
+    m_cellPoints.clear();
+    m_columns = 0;
+    m_rows = 0;
+}
+
+// Returns the index of the point closest to the position, or -1 if there is no point within
+// maxDistance. The cells are searched in rings around the cell of the position until the
+// rings are further away than the closest point found so far.
+int XYPointIndex::nearest(const QPointF &position, qreal maxDistance, Metric metric) const
+{
+    if (m_points.isEmpty())
+        return -1;
+
+    const int positionColumn = column(position.x());
+    const int positionRow = row(position.y());
+    const int maxRing = qMax(m_columns, m_rows);
+
+    int best = -1;
+    qreal bestDistance = maxDistance;
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        // Clamping positions to the grid rectangle never increases distances, so every point
+        // in this ring is at least ring - 1 cells away from the position.
+        if (ring > 1 && (ring - 1) * m_cellSize > bestDistance)
+            break;
+
+        const int top = positionRow - ring;
+        const int bottom = positionRow + ring;
+        for (int r = qMax(0, top); r <= qMin(m_rows - 1, bottom); ++r) {
+            // Only the outline of the ring is new
+            const int step = (r == top || r == bottom) ? 1 : 2 * ring;
+            for (int c = positionColumn - ring; c <= positionColumn + ring; c += qMax(1, step)) {
+                if (c < 0 || c >= m_columns)
+                    continue;
+                const int cell = r * m_columns + c;
+                for (int i = m_cellStart.at(cell); i < m_cellStart.at(cell + 1); ++i) {
+                    const int index = m_cellPoints.at(i);
+                    const qreal dx = qAbs(m_points.at(index).x() - position.x());
+                    const qreal dy = qAbs(m_points.at(index).y() - position.y());
+                    const qreal distance = (metric == ChebyshevMetric) ? qMax(dx, dy)
+                                                                       : qSqrt(dx * dx + dy * dy);
+                    if (distance <= bestDistance && (best < 0 || distance < bestDistance)) {
+                        best = index;
+                        bestDistance = distance;
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
+
+int XYPointIndex::column(qreal x) const
+{
+    const qreal c = (x - m_rect.left()) / m_cellSize;
+    // Written so that NaN ends up in the first column
+    if (!(c >= 0))
+        return 0;
+    return c >= m_columns ? m_columns - 1 : int(c);
+}
+
+int XYPointIndex::row(qreal y) const
+{
+    const qreal r = (y - m_rect.top()) / m_cellSize;
+    if (!(r >= 0))
+        return 0;
+    return r >= m_rows ? m_rows - 1 : int(r);
+}
+
+QT_CHARTS_END_NAMESPACE
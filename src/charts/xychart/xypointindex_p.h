@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+
+#ifndef XYPOINTINDEX_H
+#define XYPOINTINDEX_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointF>
+#include <QtCore/QRectF>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Uniform grid over geometry points for finding the point closest to a position, for example
+// for hit-testing markers or hover handling. Points outside the rectangle of the grid are
+// stored in the nearest edge cell.
+class Q_CHARTS_PRIVATE_EXPORT XYPointIndex
+{
+public:
+    enum Metric {
+        EuclideanMetric,
+        ChebyshevMetric
+    };
+
+    XYPointIndex();
+
+    void build(const QVector<QPointF> &points, const QRectF &rect);
+    void clear();
+    bool isEmpty() const { return m_points.isEmpty(); }
+    bool isBuiltFor(const QVector<QPointF> &points) const
+    {
+        return !points.isEmpty() && points.constData() == m_points.constData()
+                && points.size() == m_points.size();
+    }
+
+    int nearest(const QPointF &position, qreal maxDistance,
+                Metric metric = EuclideanMetric) const;
+
+private:
+    int column(qreal x) const;
+    int row(qreal y) const;
+
+    QVector<QPointF> m_points;
+    QRectF m_rect;
+    qreal m_cellSize;
+    int m_columns;
+    int m_rows;
+    // Indexes of the points sorted by cell, the points of cell i are
+    // m_cellPoints[m_cellStart[i]] ... m_cellPoints[m_cellStart[i + 1] - 1]
+    QVector<int> m_cellStart;
+    QVector<int> m_cellPoints;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYPOINTINDEX_H
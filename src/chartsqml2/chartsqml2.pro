@@ -3,7 +3,7 @@ TARGET = qtchartsqml2
 CXX_MODULE = charts
 DEFINES += QT_BUILD_QMLCHARTS_LIB
 
-QT += qml quick
+QT += qml quick gui-private
 QT += charts charts-private
 contains(QT_COORD_TYPE, float): DEFINES += QT_QREAL_IS_FLOAT
 
@@ -26,6 +26,7 @@ SOURCES += \
     declarativepolarchart.cpp \
     declarativeboxplotseries.cpp \
     declarativechartnode.cpp \
+    declarativechartrenderthread.cpp \
     declarativecandlestickseries.cpp
 
 PRIVATE_HEADERS += \
@@ -46,6 +47,7 @@ PRIVATE_HEADERS += \
     declarativecandlestickseries_p.h \
     declarativeabstractrendernode_p.h \
     declarativechartnode_p.h \
+    declarativechartrenderthread_p.h \
     declarativechartglobal_p.h
 
 contains(QT_CONFIG, opengl) {
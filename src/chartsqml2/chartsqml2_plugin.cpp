@@ -347,6 +347,9 @@ public:
         // QtCharts 2.3
         qmlRegisterType<QValueAxis, 1>(uri, 2, 3, "ValueAxis");
 
+        // QtCharts 2.15 (Qt 6.0)
+        qmlRegisterType<DeclarativeChart, 6>(uri, 2, 15, "ChartView");
+
         // The minor version used to be the current Qt 5 minor. For compatibility it is the last
         // Qt 5 release.
         qmlRegisterModule(uri, 2, 15);
@@ -29,6 +29,9 @@
 
 #include "declarativechart_p.h"
 #include <QtGui/QPainter>
+#include <QtGui/QFontDatabase>
+#include <QtGui/private/qguiapplication_p.h>
+#include <qpa/qplatformintegration.h>
 #include "declarativelineseries_p.h"
 #include "declarativeareaseries_p.h"
 #include "declarativebarseries_p.h"
@@ -38,6 +41,7 @@
 #include "declarativecandlestickseries_p.h"
 #include "declarativescatterseries_p.h"
 #include "declarativechartnode_p.h"
+#include "declarativechartrenderthread_p.h"
 #include "declarativeabstractrendernode_p.h"
 #include <QtCharts/QBarCategoryAxis>
 #include <QtCharts/QValueAxis>
@@ -49,6 +53,7 @@
 #include "declarativeaxes_p.h"
 #include <private/qchart_p.h>
 #include <private/chartpresenter_p.h>
+#include <private/charttextitem_p.h>
 #include <QtCharts/QPolarChart>
 
 #ifndef QT_QREAL_IS_FLOAT
@@ -58,8 +63,11 @@
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 #include <QtWidgets/QGraphicsSceneHoverEvent>
 #include <QtWidgets/QApplication>
+#include <QtWidgets/QGraphicsItem>
+#include <QtWidgets/QStyleOptionGraphicsItem>
 #include <QtCore/QTimer>
 #include <QtCore/QThread>
+#include <QtCore/QDataStream>
 #include <QtQuick/QQuickWindow>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -255,6 +263,72 @@ QT_CHARTS_BEGIN_NAMESPACE
   \sa localizeNumbers
 */
 
+/*!
+  \qmlproperty bool ChartView::timingEnabled
+  \since QtCharts 2.15
+
+  Whether the time spent in the parts of each frame is recorded. When \c true, the time
+  spent in laying out the chart, updating the series geometry, laying out the axes, and
+  rendering the chart is summed up per frame, and the statistics over the last 60 frames
+  can be queried with lastFrameTime(), averageFrameTime(), and maximumFrameTime().
+  Defaults to \c false.
+
+  The timing categories are \c ChartView.LayoutTiming, \c ChartView.GeometryTiming,
+  \c ChartView.AxisTiming, and \c ChartView.PaintTiming. The layout time includes the part
+  of the geometry and axis times caused by the layout.
+
+  \sa timingRecorded()
+*/
+
+/*!
+  \qmlproperty bool ChartView::threadedRendering
+  \since QtCharts 2.15
+
+  Whether the chart is rasterized on a worker thread. When \c true, the painting of the chart
+  is recorded on the GUI thread and rasterized on a thread of its own, so that rendering a
+  heavy chart does not block input handling and animations. If the thread is still busy with
+  the previous frame when the chart changes, the frame is skipped and the changes are shown in
+  the next frame. On platforms that can't render text or pixmaps outside the GUI thread, the
+  chart is rendered on the GUI thread regardless. Defaults to \c false.
+*/
+
+/*!
+  \qmlmethod real ChartView::lastFrameTime(enumeration category)
+  \since QtCharts 2.15
+  Returns the time in nanoseconds spent in \a category during the last frame.
+*/
+
+/*!
+  \qmlmethod real ChartView::averageFrameTime(enumeration category)
+  \since QtCharts 2.15
+  Returns the average time in nanoseconds spent in \a category over the last 60 frames.
+*/
+
+/*!
+  \qmlmethod real ChartView::maximumFrameTime(enumeration category)
+  \since QtCharts 2.15
+  Returns the longest time in nanoseconds spent in \a category in any of the last 60 frames.
+*/
+
+/*!
+  \qmlmethod int ChartView::timedFrameCount()
+  \since QtCharts 2.15
+  Returns the number of frames the timing statistics are computed over.
+*/
+
+/*!
+  \qmlmethod ChartView::resetTimings()
+  \since QtCharts 2.15
+  Discards the timings recorded so far.
+*/
+
+/*!
+  \qmlsignal ChartView::timingRecorded(enumeration category, real nsecs)
+  \since QtCharts 2.15
+  This signal is emitted when \l timingEnabled is \c true and a part of a frame belonging to
+  \a category has taken \a nsecs nanoseconds.
+*/
+
 /*!
   \qmlmethod AbstractSeries ChartView::series(int index)
   Returns the series with the index \a index on the chart. Together with the
@@ -460,8 +534,15 @@ QBarSet *qt_allocate_bar_set_qml(const QString &label)
 
 void DeclarativeChart::initChart(QChart::ChartType type)
 {
-    m_sceneImage = 0;
-    m_sceneImageDirty = false;
+    for (int i = 0; i < DeclarativeChartNode::LayerCount; i++) {
+        m_layers[i].devicePixelRatio = 1.0;
+        m_layers[i].textureDirty = false;
+    }
+    m_layersInvalid = false;
+    m_singleLayer = false;
+    m_threadedRendering = false;
+    m_renderThread = nullptr;
+    m_renderDeferred = false;
     m_sceneImageNeedsClear = false;
     m_guiThreadId = QThread::currentThreadId();
     m_paintThreadId = 0;
@@ -512,6 +593,8 @@ void DeclarativeChart::initChart(QChart::ChartType type)
     connect(m_chart->d_ptr->m_dataset, SIGNAL(seriesAdded(QAbstractSeries*)), this, SLOT(handleSeriesAdded(QAbstractSeries*)));
     connect(m_chart->d_ptr->m_dataset, SIGNAL(seriesRemoved(QAbstractSeries*)), this, SIGNAL(seriesRemoved(QAbstractSeries*)));
     connect(m_chart, SIGNAL(plotAreaChanged(QRectF)), this, SIGNAL(plotAreaChanged(QRectF)));
+    connect(m_chart, SIGNAL(timingRecorded(QChart::TimingCategory,qint64)),
+            this, SLOT(handleTimingRecorded(QChart::TimingCategory,qint64)));
 }
 
 void DeclarativeChart::handleSeriesAdded(QAbstractSeries *series)
@@ -519,6 +602,11 @@ void DeclarativeChart::handleSeriesAdded(QAbstractSeries *series)
     emit seriesAdded(series);
 }
 
+void DeclarativeChart::handleTimingRecorded(QChart::TimingCategory category, qint64 nsecs)
+{
+    emit timingRecorded(DeclarativeChart::TimingCategory(category), qreal(nsecs));
+}
+
 void DeclarativeChart::handlePendingRenderNodeMouseEventResponses()
 {
     const int count = m_pendingRenderNodeMouseEventResponses.size();
@@ -589,8 +677,8 @@ void DeclarativeChart::changeMargins(int top, int bottom, int left, int right)
 
 DeclarativeChart::~DeclarativeChart()
 {
+    delete m_renderThread;
     delete m_chart;
-    delete m_sceneImage;
 }
 
 void DeclarativeChart::childEvent(QChildEvent *event)
@@ -707,11 +795,14 @@ QSGNode *DeclarativeChart::updatePaintNode(QSGNode *oldNode, QQuickItem::UpdateP
 {
     DeclarativeChartNode *node = static_cast<DeclarativeChartNode *>(oldNode);
 
+    const bool newNode = !node;
     if (!node) {
         node =  new DeclarativeChartNode(window());
         // Ensure that chart is rendered whenever node is recreated
-        if (m_sceneImage)
-            m_sceneImageDirty = true;
+        for (int i = 0; i < DeclarativeChartNode::LayerCount; i++) {
+            m_layers[i].textureRect = m_layers[i].image.rect();
+            m_layers[i].textureDirty = true;
+        }
     }
 
     const QRectF &bRect = boundingRect();
@@ -760,10 +851,22 @@ QSGNode *DeclarativeChart::updatePaintNode(QSGNode *oldNode, QQuickItem::UpdateP
 
     m_pendingRenderNodeMouseEvents.clear();
 
-    // Copy chart (if dirty) to chart node
-    if (m_sceneImageDirty) {
-        node->createTextureFromImage(*m_sceneImage);
-        m_sceneImageDirty = false;
+    // Copy the dirty layers of the chart to chart node
+    if (m_renderThread) {
+        m_renderThread->uploadFrame(node, newNode);
+    } else {
+        for (int i = 0; i < DeclarativeChartNode::LayerCount; i++) {
+            SceneLayer &layer = m_layers[i];
+            if (layer.textureDirty) {
+                const DeclarativeChartNode::Layer nodeLayer = DeclarativeChartNode::Layer(i);
+                if (layer.image.isNull())
+                    node->removeLayer(nodeLayer);
+                else
+                    node->updateTextureFromImage(layer.image, layer.textureRect, nodeLayer);
+                layer.textureRect = QRect();
+                layer.textureDirty = false;
+            }
+        }
     }
 
     node->setRect(bRect);
@@ -775,7 +878,10 @@ void DeclarativeChart::sceneChanged(QList<QRectF> region)
 {
     const int count = region.size();
     const qreal limitSize = 0.01;
-    if (count && !m_updatePending) {
+    if (count && m_updatePending) {
+        // The render that is already queued takes these changes into account as well
+        m_changedRegion.append(region);
+    } else if (count) {
         qreal totalSize = 0.0;
         for (int i = 0; i < count; i++) {
             const QRectF &reg = region.at(i);
@@ -787,6 +893,7 @@ void DeclarativeChart::sceneChanged(QList<QRectF> region)
         // little point regenerating the image in these cases. These are typically cases
         // where OpenGL series are drawn to otherwise static chart.
         if (totalSize >= limitSize) {
+            m_changedRegion.append(region);
             m_updatePending = true;
             // Do async render to avoid some unnecessary renders.
             emit needRender();
@@ -797,33 +904,319 @@ void DeclarativeChart::sceneChanged(QList<QRectF> region)
     }
 }
 
+// Renders the layers of the scene that the changed region affects. A layer is rendered again
+// when the region touches the items of the layer, unless all of them are plain graphics items
+// whose state is the same as when the layer was last rendered. This way the axes and the
+// background are not rendered again when only the series change. Only the part of the layer
+// covered by the changed region is rendered and uploaded, unless it is a large part of the chart.
 void DeclarativeChart::renderScene()
 {
+    // Fraction of the chart area above which the whole layer is rendered
+    const qreal partialRenderLimit = 0.5;
+
     m_updatePending = false;
-    m_sceneImageDirty = true;
-    QSize chartSize = m_chart->size().toSize();
-    if (!m_sceneImage || chartSize != m_sceneImage->size()) {
-        delete m_sceneImage;
-        qreal dpr = window() ? window()->devicePixelRatio() : 1.0;
-        m_sceneImage = new QImage(chartSize * dpr, QImage::Format_ARGB32);
-        m_sceneImage->setDevicePixelRatio(dpr);
-        m_sceneImageNeedsClear = true;
+    if (m_renderThread && m_renderThread->isBusy()) {
+        // Frames are dropped rather than queued when the render thread falls behind. The changes
+        // are rendered together when the thread has finished the frame it is rendering.
+        m_renderDeferred = true;
+        return;
     }
 
-    if (m_sceneImageNeedsClear) {
-        m_sceneImage->fill(Qt::transparent);
-        // Don't clear the flag if chart background has any transparent element to it
-        if (m_chart->backgroundBrush().color().alpha() == 0xff && !m_chart->isDropShadowEnabled())
-            m_sceneImageNeedsClear = false;
+    const QSize chartSize = m_chart->size().toSize();
+    const qreal dpr = window() ? window()->devicePixelRatio() : 1.0;
+    const QSize deviceSize = chartSize * dpr;
+    // Graphics effects, such as the drop shadow of the background, are only applied when the
+    // scene renders the items, so the chart is rendered as a single layer when they are used.
+    const bool singleLayer = m_chart->isDropShadowEnabled();
+    const bool invalidate = m_layersInvalid || singleLayer != m_singleLayer;
+    m_layersInvalid = false;
+    m_singleLayer = singleLayer;
+
+    DeclarativeChartRenderThread::Frame frame;
+    frame.size = deviceSize;
+    frame.devicePixelRatio = dpr;
+    bool frameChanged = false;
+    {
+        ChartTimingScope timing(m_chart->d_ptr->m_presenter, QChart::PaintTiming);
+        for (int i = 0; i < DeclarativeChartNode::LayerCount; i++) {
+            const DeclarativeChartNode::Layer layerId = DeclarativeChartNode::Layer(i);
+            SceneLayer &layer = m_layers[i];
+            if (singleLayer && layerId != DeclarativeChartNode::BackgroundLayer) {
+                if (layer.size.isValid()) {
+                    layer.size = QSize();
+                    layer.image = QImage();
+                    layer.rect = QRectF();
+                    layer.state.clear();
+                    layer.textureRect = QRect();
+                    layer.textureDirty = true;
+                    frame.layers[i].remove = true;
+                    frameChanged = true;
+                }
+                continue;
+            }
+
+            bool fullRender = invalidate;
+            if (layer.size != deviceSize || layer.devicePixelRatio != dpr) {
+                layer.size = deviceSize;
+                layer.devicePixelRatio = dpr;
+                if (layerId == DeclarativeChartNode::BackgroundLayer)
+                    m_sceneImageNeedsClear = true;
+                fullRender = true;
+            }
+            if (!m_renderThread && (layer.image.size() != deviceSize
+                                    || layer.image.devicePixelRatio() != dpr)) {
+                // The OpenGL backend of the chart node can upload parts of images in this format
+                layer.image = QImage(deviceSize, QImage::Format_RGBA8888_Premultiplied);
+                layer.image.setDevicePixelRatio(dpr);
+                fullRender = true;
+            }
+
+            QRectF rect;
+            QByteArray state;
+            const bool hasState = layerState(layerId, &rect, &state);
+            bool affected = false;
+            QRectF changedRect;
+            if (!fullRender) {
+                const QRectF affectedRect = (rect | layer.rect).adjusted(-1.0, -1.0, 1.0, 1.0);
+                for (const QRectF &regionRect : qAsConst(m_changedRegion)) {
+                    if (regionRect.intersects(affectedRect)) {
+                        affected = true;
+                        changedRect |= regionRect;
+                    }
+                }
+            }
+            const bool render = fullRender
+                    || (affected && (!hasState || state != layer.state));
+            layer.rect = rect;
+            layer.state = hasState ? state : QByteArray();
+            if (!render)
+                continue;
+
+            // Render the pixels that the changed region touches, including the ones that
+            // antialiasing reaches, unless that is most of the layer anyway
+            const QRect layerRect(QPoint(0, 0), deviceSize);
+            QRect deviceRect = layerRect;
+            if (!fullRender) {
+                const QRectF sceneRect = changedRect.adjusted(-1.0, -1.0, 1.0, 1.0);
+                const QRect changedDeviceRect = QRectF(sceneRect.topLeft() * dpr,
+                                                       sceneRect.size() * dpr).toAlignedRect()
+                        & layerRect;
+                if (qreal(changedDeviceRect.width()) * changedDeviceRect.height()
+                        <= partialRenderLimit * deviceRect.width() * deviceRect.height()) {
+                    deviceRect = changedDeviceRect;
+                }
+            }
+            if (deviceRect.isEmpty())
+                continue;
+            const QRectF renderRect(QPointF(deviceRect.topLeft()) / dpr,
+                                    QSizeF(deviceRect.size()) / dpr);
+
+            const bool clear = layerId != DeclarativeChartNode::BackgroundLayer
+                    || m_sceneImageNeedsClear;
+            // Don't clear the flag if chart background has any transparent element to it
+            if (layerId == DeclarativeChartNode::BackgroundLayer
+                    && m_chart->backgroundBrush().color().alpha() == 0xff && !singleLayer) {
+                m_sceneImageNeedsClear = false;
+            }
+
+            if (m_renderThread) {
+                // Record the painting for the render thread, which is much cheaper than
+                // rasterizing it
+                DeclarativeChartRenderThread::LayerUpdate &update = frame.layers[i];
+                QPainter painter(&update.picture);
+                painter.setClipRect(renderRect);
+                paintLayerContents(&painter, layerId, renderRect);
+                painter.end();
+                update.rect = deviceRect;
+                update.clear = clear;
+                frameChanged = true;
+            } else {
+                // The items set clips of their own, which replace the clip of the painter, so
+                // paint into an image that covers only the pixels being rendered
+                QImage image = DeclarativeChartNode::imagePart(&layer.image, deviceRect);
+                if (clear)
+                    image.fill(Qt::transparent);
+                QPainter painter(&image);
+                painter.translate(-renderRect.topLeft());
+                painter.setClipRect(renderRect);
+                paintLayerContents(&painter, layerId, renderRect);
+                layer.textureRect |= deviceRect;
+                layer.textureDirty = true;
+            }
+        }
     }
-    QPainter painter(m_sceneImage);
+    m_changedRegion.clear();
+    m_chart->d_ptr->m_presenter->endTimingFrame();
+    if (m_renderThread && frameChanged)
+        m_renderThread->render(frame);
+    else
+        update();
+}
+
+// Paints the layer, or the whole scene when it is rendered as a single layer
+void DeclarativeChart::paintLayerContents(QPainter *painter, DeclarativeChartNode::Layer layer,
+                                          const QRectF &rect)
+{
     if (antialiasing()) {
-        painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing
-                               | QPainter::SmoothPixmapTransform);
+        painter->setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing
+                                | QPainter::SmoothPixmapTransform);
     }
-    QRect renderRect(QPoint(0, 0), chartSize);
-    m_scene->render(&painter, renderRect, renderRect);
+    if (m_singleLayer)
+        m_scene->render(painter, rect, rect);
+    else
+        paintLayer(painter, m_chart, rect, layer, DeclarativeChartNode::BackgroundLayer);
+}
+
+void DeclarativeChart::handleFrameRendered()
+{
     update();
+    if (m_renderDeferred) {
+        m_renderDeferred = false;
+        renderScene();
+    }
+}
+
+// The chart paints nothing itself, as the background is a separate item
+bool DeclarativeChart::hasContents(const QGraphicsItem *item) const
+{
+    return item != m_chart && !(item->flags() & QGraphicsItem::ItemHasNoContents);
+}
+
+// Returns the layer of the item. The direct children of the chart are divided into the layers
+// by their z-value, and the other items are in the layer of their parent.
+DeclarativeChartNode::Layer DeclarativeChart::itemLayer(const QGraphicsItem *item,
+                                                        DeclarativeChartNode::Layer parentLayer) const
+{
+    if (m_singleLayer || item->parentItem() != m_chart)
+        return parentLayer;
+    if (item->zValue() >= ChartPresenter::LegendZValue)
+        return DeclarativeChartNode::OverlayLayer;
+    if (item->zValue() >= ChartPresenter::SeriesZValue)
+        return DeclarativeChartNode::SeriesLayer;
+    return DeclarativeChartNode::BackgroundLayer;
+}
+
+// Collects the scene area covered by the visible items of the layer into rect, and a snapshot
+// of the items into state. Returns false if the layer contains items whose painting is not
+// described by the snapshot.
+bool DeclarativeChart::layerState(DeclarativeChartNode::Layer layer, QRectF *rect,
+                                  QByteArray *state) const
+{
+    QDataStream stream(state, QIODevice::WriteOnly);
+    // The rounded corners and the drop shadow of the background are not described by the
+    // state of its item
+    if (layer == DeclarativeChartNode::BackgroundLayer)
+        stream << m_chart->backgroundRoundness() << m_chart->isDropShadowEnabled();
+    return collectLayerState(m_chart, layer, DeclarativeChartNode::BackgroundLayer, rect,
+                             &stream);
+}
+
+bool DeclarativeChart::collectLayerState(const QGraphicsItem *item,
+                                         DeclarativeChartNode::Layer layer,
+                                         DeclarativeChartNode::Layer parentLayer, QRectF *rect,
+                                         QDataStream *stream) const
+{
+    if (!item->isVisible())
+        return true;
+
+    const DeclarativeChartNode::Layer layerOfItem = itemLayer(item, parentLayer);
+    bool hasState = true;
+    if (layerOfItem == layer && hasContents(item)) {
+        *rect |= item->sceneBoundingRect();
+        *stream << item->type() << item->sceneTransform() << item->effectiveOpacity()
+                << item->boundingRect();
+        switch (item->type()) {
+        case QGraphicsRectItem::Type: {
+            const QGraphicsRectItem *rectItem = static_cast<const QGraphicsRectItem *>(item);
+            *stream << rectItem->rect() << rectItem->pen() << rectItem->brush();
+            break;
+        }
+        case QGraphicsEllipseItem::Type: {
+            const QGraphicsEllipseItem *ellipseItem
+                    = static_cast<const QGraphicsEllipseItem *>(item);
+            *stream << ellipseItem->rect() << ellipseItem->startAngle()
+                    << ellipseItem->spanAngle() << ellipseItem->pen() << ellipseItem->brush();
+            break;
+        }
+        case QGraphicsPathItem::Type: {
+            const QGraphicsPathItem *pathItem = static_cast<const QGraphicsPathItem *>(item);
+            *stream << pathItem->path() << pathItem->pen() << pathItem->brush();
+            break;
+        }
+        case QGraphicsLineItem::Type: {
+            const QGraphicsLineItem *lineItem = static_cast<const QGraphicsLineItem *>(item);
+            *stream << lineItem->line() << lineItem->pen();
+            break;
+        }
+        case QGraphicsTextItem::Type: {
+            const QGraphicsTextItem *textItem = static_cast<const QGraphicsTextItem *>(item);
+            *stream << textItem->toHtml() << textItem->font() << textItem->defaultTextColor();
+            break;
+        }
+        case ChartTextItem::Type: {
+            const ChartTextItem *textItem = static_cast<const ChartTextItem *>(item);
+            *stream << textItem->text() << textItem->isStaticText() << textItem->font()
+                    << textItem->defaultTextColor();
+            if (!textItem->isStaticText())
+                *stream << textItem->toHtml();
+            break;
+        }
+        default:
+            hasState = false;
+            break;
+        }
+    }
+
+    const QList<QGraphicsItem *> children = item->childItems();
+    for (const QGraphicsItem *child : children) {
+        if (!collectLayerState(child, layer, layerOfItem, rect, stream))
+            hasState = false;
+    }
+    return hasState;
+}
+
+// Paints the items of the layer in the subtree of the item that intersect the scene rect, in the
+// same order and with the same clipping as QGraphicsScene::render() does. The transformation of
+// the painter maps the scene to the device.
+void DeclarativeChart::paintLayer(QPainter *painter, QGraphicsItem *item, const QRectF &rect,
+                                  DeclarativeChartNode::Layer layer,
+                                  DeclarativeChartNode::Layer parentLayer) const
+{
+    if (!item->isVisible())
+        return;
+
+    const DeclarativeChartNode::Layer layerOfItem = itemLayer(item, parentLayer);
+    const QList<QGraphicsItem *> children = item->childItems();
+    painter->save();
+    if (item->flags() & QGraphicsItem::ItemClipsChildrenToShape) {
+        painter->setClipPath(item->sceneTransform().map(item->shape()), Qt::IntersectClip);
+    }
+
+    int i = 0;
+    for (; i < children.size(); i++) {
+        if (!(children.at(i)->flags() & QGraphicsItem::ItemStacksBehindParent))
+            break;
+        paintLayer(painter, children.at(i), rect, layer, layerOfItem);
+    }
+
+    if (layerOfItem == layer && hasContents(item) && item->sceneBoundingRect().intersects(rect)) {
+        painter->save();
+        painter->setWorldTransform(item->sceneTransform(), true);
+        painter->setOpacity(item->effectiveOpacity());
+        if (item->flags() & QGraphicsItem::ItemClipsToShape)
+            painter->setClipPath(item->shape(), Qt::IntersectClip);
+        QStyleOptionGraphicsItem option;
+        option.exposedRect = item->boundingRect();
+        option.rect = option.exposedRect.toAlignedRect();
+        if (item->isEnabled())
+            option.state |= QStyle::State_Enabled;
+        item->paint(painter, &option, nullptr);
+        painter->restore();
+    }
+
+    for (; i < children.size(); i++)
+        paintLayer(painter, children.at(i), rect, layer, layerOfItem);
+    painter->restore();
 }
 
 void DeclarativeChart::mousePressEvent(QMouseEvent *event)
@@ -946,6 +1339,7 @@ void DeclarativeChart::mouseDoubleClickEvent(QMouseEvent *event)
 void DeclarativeChart::handleAntialiasingChanged(bool enable)
 {
     setAntialiasing(enable);
+    m_layersInvalid = true;
     emit needRender();
 }
 
@@ -1123,6 +1517,76 @@ QLocale QtCharts::DeclarativeChart::locale() const
     return m_chart->locale();
 }
 
+void DeclarativeChart::setThreadedRendering(bool threaded)
+{
+    if (threaded != m_threadedRendering) {
+        m_threadedRendering = threaded;
+        // Text and pixmaps can't be rasterized outside the GUI thread on every platform, in
+        // which case the chart keeps being rendered on the GUI thread
+        const bool supported = QFontDatabase::supportsThreadedFontRendering()
+                && QGuiApplicationPrivate::platformIntegration()->hasCapability(
+                    QPlatformIntegration::ThreadedPixmaps);
+        if (threaded && supported) {
+            m_renderThread = new DeclarativeChartRenderThread(this);
+            connect(m_renderThread, &DeclarativeChartRenderThread::frameRendered,
+                    this, &DeclarativeChart::handleFrameRendered, Qt::QueuedConnection);
+            m_renderThread->start();
+            for (int i = 0; i < DeclarativeChartNode::LayerCount; i++)
+                m_layers[i].image = QImage();
+        } else if (m_renderThread) {
+            delete m_renderThread;
+            m_renderThread = nullptr;
+            m_renderDeferred = false;
+        }
+        m_layersInvalid = true;
+        emit threadedRenderingChanged();
+        emit needRender();
+    }
+}
+
+bool DeclarativeChart::isThreadedRendering() const
+{
+    return m_threadedRendering;
+}
+
+void DeclarativeChart::setTimingEnabled(bool enabled)
+{
+    if (m_chart->isTimingEnabled() != enabled) {
+        m_chart->setTimingEnabled(enabled);
+        emit timingEnabledChanged();
+    }
+}
+
+bool DeclarativeChart::isTimingEnabled() const
+{
+    return m_chart->isTimingEnabled();
+}
+
+qreal DeclarativeChart::lastFrameTime(int category) const
+{
+    return m_chart->lastFrameTime(QChart::TimingCategory(category));
+}
+
+qreal DeclarativeChart::averageFrameTime(int category) const
+{
+    return m_chart->averageFrameTime(QChart::TimingCategory(category));
+}
+
+qreal DeclarativeChart::maximumFrameTime(int category) const
+{
+    return m_chart->maximumFrameTime(QChart::TimingCategory(category));
+}
+
+int DeclarativeChart::timedFrameCount() const
+{
+    return m_chart->timedFrameCount();
+}
+
+void DeclarativeChart::resetTimings()
+{
+    m_chart->resetTimings();
+}
+
 int DeclarativeChart::count()
 {
     return m_chart->series().count();
@@ -42,6 +42,7 @@
 #include <private/glxyseriesdata_p.h>
 #include <private/declarativechartglobal_p.h>
 #include <private/declarativeabstractrendernode_p.h>
+#include <private/declarativechartnode_p.h>
 
 #include <QtCore/QtGlobal>
 #include <QtQuick/QQuickItem>
@@ -49,13 +50,20 @@
 
 #include <QtCharts/QChart>
 #include <QtCore/QLocale>
+#include <QtGui/QImage>
 #include <QQmlComponent>
 
+QT_BEGIN_NAMESPACE
+class QDataStream;
+class QPainter;
+QT_END_NAMESPACE
+
 QT_CHARTS_BEGIN_NAMESPACE
 
 class DeclarativeMargins;
 class Domain;
 class DeclarativeAxes;
+class DeclarativeChartRenderThread;
 
 class Q_QMLCHARTS_PRIVATE_EXPORT DeclarativeChart : public QQuickItem
 {
@@ -78,9 +86,12 @@ class Q_QMLCHARTS_PRIVATE_EXPORT DeclarativeChart : public QQuickItem
     Q_PROPERTY(QQmlListProperty<QAbstractAxis> axes READ axes REVISION 2)
     Q_PROPERTY(bool localizeNumbers READ localizeNumbers WRITE setLocalizeNumbers NOTIFY localizeNumbersChanged REVISION 4)
     Q_PROPERTY(QLocale locale READ locale WRITE setLocale NOTIFY localeChanged REVISION 4)
+    Q_PROPERTY(bool timingEnabled READ isTimingEnabled WRITE setTimingEnabled NOTIFY timingEnabledChanged REVISION 6)
+    Q_PROPERTY(bool threadedRendering READ isThreadedRendering WRITE setThreadedRendering NOTIFY threadedRenderingChanged REVISION 6)
     Q_ENUMS(Animation)
     Q_ENUMS(Theme)
     Q_ENUMS(SeriesType)
+    Q_ENUMS(TimingCategory)
 
 public:
     // duplicating enums from QChart to make the QML api namings 1-to-1 with the C++ api
@@ -118,6 +129,13 @@ public:
         SeriesTypeCandlestick
     };
 
+    enum TimingCategory {
+        LayoutTiming = 0,
+        GeometryTiming,
+        AxisTiming,
+        PaintTiming
+    };
+
 public:
     DeclarativeChart(QQuickItem *parent = 0);
     ~DeclarativeChart();
@@ -161,6 +179,10 @@ public:
     bool localizeNumbers() const;
     void setLocale(const QLocale &locale);
     QLocale locale() const;
+    void setTimingEnabled(bool enabled);
+    bool isTimingEnabled() const;
+    void setThreadedRendering(bool threaded);
+    bool isThreadedRendering() const;
 
     int count();
     void setDropShadowEnabled(bool enabled);
@@ -207,6 +229,11 @@ public:
                                                  QAbstractSeries *series = 0);
     Q_REVISION(5) Q_INVOKABLE QPointF mapToPosition(const QPointF &value,
                                                     QAbstractSeries *series = 0);
+    Q_REVISION(6) Q_INVOKABLE qreal lastFrameTime(int category) const;
+    Q_REVISION(6) Q_INVOKABLE qreal averageFrameTime(int category) const;
+    Q_REVISION(6) Q_INVOKABLE qreal maximumFrameTime(int category) const;
+    Q_REVISION(6) Q_INVOKABLE int timedFrameCount() const;
+    Q_REVISION(6) Q_INVOKABLE void resetTimings();
 
 
 Q_SIGNALS:
@@ -224,6 +251,9 @@ Q_SIGNALS:
     Q_REVISION(4) void localeChanged();
     Q_REVISION(5) void animationDurationChanged(int msecs);
     Q_REVISION(5) void animationEasingCurveChanged(QEasingCurve curve);
+    Q_REVISION(6) void timingEnabledChanged();
+    Q_REVISION(6) void timingRecorded(DeclarativeChart::TimingCategory category, qreal nsecs);
+    Q_REVISION(6) void threadedRenderingChanged();
     void needRender();
     void pendingRenderNodeMouseEventResponses();
 
@@ -235,6 +265,8 @@ private Q_SLOTS:
     void handleAxisYRightSet(QAbstractAxis *axis);
     void handleSeriesAdded(QAbstractSeries *series);
     void handlePendingRenderNodeMouseEventResponses();
+    void handleTimingRecorded(QChart::TimingCategory category, qint64 nsecs);
+    void handleFrameRendered();
 
 protected:
     explicit DeclarativeChart(QChart::ChartType type, QQuickItem *parent);
@@ -246,6 +278,18 @@ private:
     void findMinMaxForSeries(QAbstractSeries *series,Qt::Orientations orientation,
                              qreal &min, qreal &max);
     void queueRendererMouseEvent(QMouseEvent *event);
+    bool hasContents(const QGraphicsItem *item) const;
+    DeclarativeChartNode::Layer itemLayer(const QGraphicsItem *item,
+                                          DeclarativeChartNode::Layer parentLayer) const;
+    bool layerState(DeclarativeChartNode::Layer layer, QRectF *rect, QByteArray *state) const;
+    bool collectLayerState(const QGraphicsItem *item, DeclarativeChartNode::Layer layer,
+                           DeclarativeChartNode::Layer parentLayer, QRectF *rect,
+                           QDataStream *stream) const;
+    void paintLayerContents(QPainter *painter, DeclarativeChartNode::Layer layer,
+                            const QRectF &rect);
+    void paintLayer(QPainter *painter, QGraphicsItem *item, const QRectF &rect,
+                    DeclarativeChartNode::Layer layer,
+                    DeclarativeChartNode::Layer parentLayer) const;
 
     // Extending QChart with DeclarativeChart is not possible because QObject does not support
     // multi inheritance, so we now have a QChart as a member instead
@@ -257,8 +301,28 @@ private:
     QPoint m_lastMouseMoveScreenPoint;
     Qt::MouseButton m_mousePressButton;
     Qt::MouseButtons m_mousePressButtons;
-    QImage *m_sceneImage;
-    bool m_sceneImageDirty;
+    // The scene is rendered as separately cached layers, so that changing the series does not
+    // repaint the axes and the background, for example
+    struct SceneLayer {
+        QSize size;
+        qreal devicePixelRatio;
+        // Not used when the layers are rendered by m_renderThread
+        QImage image;
+        // Scene area covered by the items of the layer when it was last rendered
+        QRectF rect;
+        // Snapshot of the items of the layer, empty if they can't be compared by their state
+        QByteArray state;
+        // Part of the image that has changed since it was uploaded to the texture
+        QRect textureRect;
+        bool textureDirty;
+    };
+    SceneLayer m_layers[DeclarativeChartNode::LayerCount];
+    QList<QRectF> m_changedRegion;
+    bool m_layersInvalid;
+    bool m_singleLayer;
+    bool m_threadedRendering;
+    DeclarativeChartRenderThread *m_renderThread;
+    bool m_renderDeferred;
     bool m_updatePending;
     Qt::HANDLE m_paintThreadId;
     Qt::HANDLE m_guiThreadId;
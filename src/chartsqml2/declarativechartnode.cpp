@@ -36,6 +36,8 @@
 
 #ifndef QT_NO_OPENGL
 # include "declarativeopenglrendernode_p.h"
+# include <QtGui/QOpenGLContext>
+# include <QtGui/QOpenGLFunctions>
 #endif
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -44,9 +46,13 @@ QT_CHARTS_BEGIN_NAMESPACE
 DeclarativeChartNode::DeclarativeChartNode(QQuickWindow *window) :
     QSGRootNode(),
     m_window(window),
-    m_renderNode(nullptr),
-    m_imageNode(nullptr)
+    m_renderNode(nullptr)
 {
+    for (int i = 0; i < LayerCount; i++) {
+        m_imageNodes[i] = nullptr;
+        m_textureIds[i] = 0;
+    }
+
     // Create a DeclarativeRenderNode for correct QtQuick Backend
 #ifndef QT_NO_OPENGL
     if (m_window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL)
@@ -64,33 +70,120 @@ DeclarativeChartNode::~DeclarativeChartNode()
 {
 }
 
+static auto const defaultTextureOptions = QQuickWindow::CreateTextureOptions(QQuickWindow::TextureHasAlphaChannel |
+                                                                             QQuickWindow::TextureOwnsGLTexture);
+
 // Must be called on render thread and in context
-void DeclarativeChartNode::createTextureFromImage(const QImage &chartImage)
+void DeclarativeChartNode::createTextureFromImage(const QImage &chartImage, Layer layer)
+{
+    m_textureIds[layer] = 0;
+    setLayerTexture(m_window->createTextureFromImage(chartImage, defaultTextureOptions), layer);
+}
+
+// Uploads the rect of the image to the texture of the layer. With the OpenGL backend, an image
+// in Format_RGBA8888_Premultiplied is uploaded into a texture of our own, so that only the rect
+// needs to be uploaded when the image changes. Must be called on render thread and in context.
+void DeclarativeChartNode::updateTextureFromImage(const QImage &chartImage, const QRect &rect,
+                                                  Layer layer)
 {
-    static auto const defaultTextureOptions = QQuickWindow::CreateTextureOptions(QQuickWindow::TextureHasAlphaChannel |
-                                                                                 QQuickWindow::TextureOwnsGLTexture);
+#ifndef QT_NO_OPENGL
+    if (m_window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL
+            && chartImage.format() == QImage::Format_RGBA8888_Premultiplied) {
+        QOpenGLFunctions *functions = QOpenGLContext::currentContext()->functions();
+        if (m_imageNodes[layer] && m_textureIds[layer] && m_textureSizes[layer] == chartImage.size()) {
+            if (rect.isEmpty())
+                return;
+            const QImage part = chartImage.copy(rect);
+            functions->glBindTexture(GL_TEXTURE_2D, m_textureIds[layer]);
+            functions->glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x(), rect.y(), rect.width(),
+                                       rect.height(), GL_RGBA, GL_UNSIGNED_BYTE, part.constBits());
+            functions->glBindTexture(GL_TEXTURE_2D, 0);
+            return;
+        }
+
+        GLuint textureId = 0;
+        functions->glGenTextures(1, &textureId);
+        functions->glBindTexture(GL_TEXTURE_2D, textureId);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        functions->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, chartImage.width(), chartImage.height(),
+                                0, GL_RGBA, GL_UNSIGNED_BYTE, chartImage.constBits());
+        functions->glBindTexture(GL_TEXTURE_2D, 0);
+        m_textureIds[layer] = textureId;
+        m_textureSizes[layer] = chartImage.size();
+        setLayerTexture(m_window->createTextureFromId(textureId, chartImage.size(),
+                                                      defaultTextureOptions), layer);
+        return;
+    }
+#else
+    Q_UNUSED(rect)
+#endif
+    createTextureFromImage(chartImage, layer);
+}
 
-    auto texture = m_window->createTextureFromImage(chartImage, defaultTextureOptions);
+void DeclarativeChartNode::setLayerTexture(QSGTexture *texture, Layer layer)
+{
+    QSGImageNode *&imageNode = m_imageNodes[layer];
     // Create Image node if needed
-    if (!m_imageNode) {
-        m_imageNode = m_window->createImageNode();
-        m_imageNode->setFlag(OwnedByParent);
-        m_imageNode->setOwnsTexture(true);
-        m_imageNode->setTexture(texture);
-        prependChildNode(m_imageNode);
+    if (!imageNode) {
+        imageNode = m_window->createImageNode();
+        imageNode->setFlag(OwnedByParent);
+        imageNode->setOwnsTexture(true);
+        imageNode->setTexture(texture);
+        if (QSGNode *above = nodeAbove(layer))
+            insertChildNodeBefore(imageNode, above);
+        else
+            appendChildNode(imageNode);
     } else {
-        m_imageNode->setTexture(texture);
+        imageNode->setTexture(texture);
     }
     if (!m_rect.isEmpty())
-        m_imageNode->setRect(m_rect);
+        imageNode->setRect(m_rect);
+}
+
+void DeclarativeChartNode::removeLayer(Layer layer)
+{
+    if (m_imageNodes[layer]) {
+        removeChildNode(m_imageNodes[layer]);
+        delete m_imageNodes[layer];
+        m_imageNodes[layer] = nullptr;
+        m_textureIds[layer] = 0;
+    }
 }
 
 void DeclarativeChartNode::setRect(const QRectF &rect)
 {
     m_rect = rect;
 
-    if (m_imageNode)
-        m_imageNode->setRect(rect);
+    for (int i = 0; i < LayerCount; i++) {
+        if (m_imageNodes[i])
+            m_imageNodes[i]->setRect(rect);
+    }
+}
+
+// Returns an image that shares the pixels of the rect of the image, so that nothing painted into
+// it can reach outside the rect
+QImage DeclarativeChartNode::imagePart(QImage *image, const QRect &rect)
+{
+    const int bytesPerPixel = image->depth() / 8;
+    uchar *bits = image->bits() + rect.y() * image->bytesPerLine() + rect.x() * bytesPerPixel;
+    QImage part(bits, rect.width(), rect.height(), image->bytesPerLine(), image->format());
+    part.setDevicePixelRatio(image->devicePixelRatio());
+    return part;
+}
+
+// Returns the node that the image node of the layer is inserted below
+QSGNode *DeclarativeChartNode::nodeAbove(Layer layer) const
+{
+    for (int i = layer + 1; i < LayerCount; i++) {
+        if (i == OverlayLayer && m_renderNode)
+            return m_renderNode;
+        if (m_imageNodes[i])
+            return m_imageNodes[i];
+    }
+    return nullptr;
 }
 
 QT_CHARTS_END_NAMESPACE
@@ -50,19 +50,37 @@ class DeclarativeAbstractRenderNode;
 class DeclarativeChartNode : public QSGRootNode
 {
 public:
+    // The chart is drawn as separately textured layers. The OpenGL series are drawn between
+    // the series and overlay layers.
+    enum Layer {
+        BackgroundLayer = 0,
+        SeriesLayer,
+        OverlayLayer,
+        LayerCount
+    };
+
     DeclarativeChartNode(QQuickWindow *window);
     ~DeclarativeChartNode();
 
-    void createTextureFromImage(const QImage &chartImage);
+    void createTextureFromImage(const QImage &chartImage, Layer layer = BackgroundLayer);
+    void updateTextureFromImage(const QImage &chartImage, const QRect &rect, Layer layer);
+    void removeLayer(Layer layer);
+    static QImage imagePart(QImage *image, const QRect &rect);
     DeclarativeAbstractRenderNode *renderNode() const { return m_renderNode; }
 
     void setRect(const QRectF &rect);
 
 private:
+    void setLayerTexture(QSGTexture *texture, Layer layer);
+    QSGNode *nodeAbove(Layer layer) const;
+
     QRectF m_rect;
     QQuickWindow *m_window;
     DeclarativeAbstractRenderNode *m_renderNode;
-    QSGImageNode *m_imageNode;
+    QSGImageNode *m_imageNodes[LayerCount];
+    // OpenGL textures of the layers that can be partially updated, or zero
+    uint m_textureIds[LayerCount];
+    QSize m_textureSizes[LayerCount];
 };
 
 QT_CHARTS_END_NAMESPACE
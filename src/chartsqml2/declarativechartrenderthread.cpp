@@ -0,0 +1,179 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "declarativechartrenderthread_p.h"
+
+#include <QtCore/QMutexLocker>
+#include <QtGui/QPainter>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Copies the rect of the image to the same place in the other image of the same size and format
+static void copyRect(const QImage &source, QImage *target, const QRect &rect)
+{
+    const QRect copiedRect = rect & source.rect();
+    const int bytesPerPixel = source.depth() / 8;
+    const int offset = copiedRect.left() * bytesPerPixel;
+    const int length = copiedRect.width() * bytesPerPixel;
+    for (int y = copiedRect.top(); y <= copiedRect.bottom(); y++)
+        memcpy(target->scanLine(y) + offset, source.constScanLine(y) + offset, length);
+}
+
+DeclarativeChartRenderThread::DeclarativeChartRenderThread(QObject *parent)
+    : QThread(parent),
+      m_frameQueued(false),
+      m_busy(false),
+      m_quit(false)
+{
+}
+
+DeclarativeChartRenderThread::~DeclarativeChartRenderThread()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_quit = true;
+        m_condition.wakeOne();
+    }
+    wait();
+}
+
+// Returns true if the thread has not finished the last frame given to it
+bool DeclarativeChartRenderThread::isBusy() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_busy;
+}
+
+void DeclarativeChartRenderThread::render(const Frame &frame)
+{
+    QMutexLocker locker(&m_mutex);
+    m_frame = frame;
+    m_frameQueued = true;
+    m_busy = true;
+    m_condition.wakeOne();
+}
+
+// Uploads the changed parts of the front buffers to the textures of the node, or all of them.
+// Must be called on render thread and in context.
+void DeclarativeChartRenderThread::uploadFrame(DeclarativeChartNode *node, bool all)
+{
+    QMutexLocker locker(&m_mutex);
+    for (int i = 0; i < DeclarativeChartNode::LayerCount; i++) {
+        LayerBuffers &buffers = m_layers[i];
+        if (!buffers.dirty && !all)
+            continue;
+        const DeclarativeChartNode::Layer layer = DeclarativeChartNode::Layer(i);
+        if (buffers.front.isNull()) {
+            node->removeLayer(layer);
+        } else {
+            node->updateTextureFromImage(buffers.front,
+                                         all ? buffers.front.rect() : buffers.frontChanged,
+                                         layer);
+        }
+        buffers.frontChanged = QRect();
+        buffers.dirty = false;
+    }
+}
+
+void DeclarativeChartRenderThread::run()
+{
+    forever {
+        Frame frame;
+        {
+            QMutexLocker locker(&m_mutex);
+            while (!m_frameQueued && !m_quit)
+                m_condition.wait(&m_mutex);
+            if (m_quit)
+                return;
+            frame = m_frame;
+            m_frame = Frame();
+            m_frameQueued = false;
+        }
+
+        for (int i = 0; i < DeclarativeChartNode::LayerCount; i++)
+            renderLayer(i, frame);
+
+        {
+            QMutexLocker locker(&m_mutex);
+            for (int i = 0; i < DeclarativeChartNode::LayerCount; i++) {
+                const LayerUpdate &update = frame.layers[i];
+                LayerBuffers &buffers = m_layers[i];
+                if (update.remove) {
+                    buffers.front = QImage();
+                    buffers.back = QImage();
+                    buffers.backMissing = QRect();
+                    buffers.frontChanged = QRect();
+                    buffers.dirty = true;
+                } else if (!update.rect.isEmpty()) {
+                    qSwap(buffers.front, buffers.back);
+                    buffers.backMissing = update.rect;
+                    buffers.frontChanged |= update.rect;
+                    buffers.dirty = true;
+                }
+            }
+            m_busy = false;
+        }
+        emit frameRendered();
+    }
+}
+
+// Renders the update of the layer into its back buffer. The front buffer is only replaced by
+// this thread, so it can be read without locking.
+void DeclarativeChartRenderThread::renderLayer(int layer, const Frame &frame)
+{
+    const LayerUpdate &update = frame.layers[layer];
+    if (update.remove || update.rect.isEmpty())
+        return;
+
+    LayerBuffers &buffers = m_layers[layer];
+    if (buffers.back.size() != frame.size) {
+        // The whole layer is rendered when its size changes
+        if (buffers.front.size() == frame.size)
+            buffers.back = buffers.front.copy();
+        else
+            buffers.back = QImage(frame.size, QImage::Format_RGBA8888_Premultiplied);
+    } else if (!buffers.backMissing.isEmpty()) {
+        copyRect(buffers.front, &buffers.back, buffers.backMissing);
+    }
+    buffers.back.setDevicePixelRatio(frame.devicePixelRatio);
+
+    // The clip of the recording is replaced by the clips the items set, so play the picture back
+    // into an image that covers only the pixels of the update
+    const qreal dpr = frame.devicePixelRatio;
+    const QRectF rect(QPointF(update.rect.topLeft()) / dpr, QSizeF(update.rect.size()) / dpr);
+    QImage image = DeclarativeChartNode::imagePart(&buffers.back, update.rect);
+    if (update.clear)
+        image.fill(Qt::transparent);
+    QPainter painter(&image);
+    painter.translate(-rect.topLeft());
+    painter.setClipRect(rect);
+    painter.drawPicture(0, 0, update.picture);
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef DECLARATIVECHARTRENDERTHREAD_P_H
+#define DECLARATIVECHARTRENDERTHREAD_P_H
+
+#include <private/declarativechartnode_p.h>
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+#include <QtGui/QImage>
+#include <QtGui/QPicture>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Rasterizes the layers of a chart on a worker thread. The GUI thread records the painting of
+// the changed part of each layer into a QPicture, and the thread plays it back into the back
+// buffer of the layer. Once the frame is done, the back and front buffers are swapped and the
+// front buffers are uploaded in updatePaintNode(). Only one frame is rendered at a time, so the
+// GUI thread is expected to skip frames while the thread is busy.
+class DeclarativeChartRenderThread : public QThread
+{
+    Q_OBJECT
+
+public:
+    struct LayerUpdate {
+        LayerUpdate() : clear(false), remove(false) {}
+        QPicture picture;
+        // Device pixels of the layer to render, empty if the layer doesn't change
+        QRect rect;
+        bool clear;
+        bool remove;
+    };
+    struct Frame {
+        Frame() : devicePixelRatio(1.0) {}
+        QSize size;
+        qreal devicePixelRatio;
+        LayerUpdate layers[DeclarativeChartNode::LayerCount];
+    };
+
+    explicit DeclarativeChartRenderThread(QObject *parent = nullptr);
+    ~DeclarativeChartRenderThread();
+
+    bool isBusy() const;
+    void render(const Frame &frame);
+    void uploadFrame(DeclarativeChartNode *node, bool all);
+
+Q_SIGNALS:
+    void frameRendered();
+
+protected:
+    void run() override;
+
+private:
+    void renderLayer(int layer, const Frame &frame);
+
+    struct LayerBuffers {
+        LayerBuffers() : dirty(false) {}
+        QImage front;
+        QImage back;
+        // Part of the front buffer that the back buffer is missing
+        QRect backMissing;
+        // Part of the front buffer that has changed since it was uploaded
+        QRect frontChanged;
+        bool dirty;
+    };
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_condition;
+    Frame m_frame;
+    bool m_frameQueued;
+    bool m_busy;
+    bool m_quit;
+    LayerBuffers m_layers[DeclarativeChartNode::LayerCount];
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // DECLARATIVECHARTRENDERTHREAD_P_H
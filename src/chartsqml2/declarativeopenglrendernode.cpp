@@ -216,6 +216,31 @@ void DeclarativeOpenGLRenderNode::setTextureSize(const QSize &size)
     m_selectionRenderNeeded = true;
 }
 
+// Copies the series data and uploads the changed points right away, while the gui thread is
+// blocked. The points themselves are not kept, so that the chart can keep appending to its
+// array without the array being copied.
+// Must be called on render thread while gui thread is blocked, and in context
+void DeclarativeOpenGLRenderNode::copySeriesData(const QXYSeries *series, GLXYSeriesData *data,
+                                                 const GLXYSeriesData *newData)
+{
+    *data = *newData;
+    data->array = QVector<float>();
+
+    bool all = newData->arrayDirty;
+    QOpenGLBuffer *vbo = m_seriesBufferMap.value(series);
+    if (!vbo) {
+        vbo = new QOpenGLBuffer;
+        m_seriesBufferMap.insert(series, vbo);
+        vbo->create();
+        all = true;
+    }
+    if (all || newData->dirtyStart < newData->dirtyEnd) {
+        vbo->bind();
+        GLXYSeriesDataManager::uploadPoints(vbo, newData, all);
+        vbo->release();
+    }
+}
+
 // Must be called on render thread while gui thread is blocked, and in context
 void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap &dataMap)
 {
@@ -228,9 +253,11 @@ void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap
         for (auto i = dataMap.begin(), end = dataMap.end(); i != end; ++i) {
             GLXYSeriesData *data = oldMap.take(i.key());
             const GLXYSeriesData *newData = i.value();
-            if (!data || newData->dirty) {
+            if (!data) {
                 data = new GLXYSeriesData;
-                *data = *newData;
+                copySeriesData(i.key(), data, newData);
+            } else if (newData->dirty) {
+                copySeriesData(i.key(), data, newData);
             }
             m_xyDataMap.insert(i.key(), data);
         }
@@ -248,7 +275,7 @@ void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap
                 dirty = true;
                 GLXYSeriesData *data = m_xyDataMap.value(i.key());
                 if (data)
-                    *data = *newData;
+                    copySeriesData(i.key(), data, newData);
             }
         }
     }
@@ -321,24 +348,18 @@ void DeclarativeOpenGLRenderNode::renderGL(bool selection)
             m_program->setUniformValue(m_deltaUniformLoc, data->delta);
             m_program->setUniformValue(m_matrixUniformLoc, data->matrix);
 
-            if (!vbo) {
-                vbo = new QOpenGLBuffer;
-                m_seriesBufferMap.insert(i.key(), vbo);
-                vbo->create();
-            }
+            // The points have been uploaded in setSeriesData()
+            if (!vbo)
+                continue;
             vbo->bind();
-            if (data->dirty) {
-                vbo->allocate(data->array.constData(), data->array.count() * sizeof(GLfloat));
-                data->dirty = false;
-            }
 
             glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
             if (data->type == QAbstractSeries::SeriesTypeLine) {
                 glLineWidth(data->width);
-                glDrawArrays(GL_LINE_STRIP, 0, data->array.size() / 2);
+                glDrawArrays(GL_LINE_STRIP, data->start, data->pointCount);
             } else { // Scatter
                 m_program->setUniformValue(m_pointSizeUniformLoc, data->width);
-                glDrawArrays(GL_POINTS, 0, data->array.size() / 2);
+                glDrawArrays(GL_POINTS, data->start, data->pointCount);
             }
             vbo->release();
         }
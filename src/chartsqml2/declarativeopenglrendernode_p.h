@@ -74,6 +74,8 @@ public Q_SLOTS:
     void render();
 
 private:
+    void copySeriesData(const QXYSeries *series, GLXYSeriesData *data,
+                        const GLXYSeriesData *newData);
     void renderGL(bool selection);
     void renderSelection();
     void renderVisual();
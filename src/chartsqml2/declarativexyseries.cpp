@@ -52,18 +52,25 @@ void DeclarativeXySeries::componentComplete()
     QXYSeries *series = qobject_cast<QXYSeries *>(xySeries());
     Q_ASSERT(series);
 
+    // Consecutive XYPoint children are appended as one block
+    QList<QPointF> points;
     foreach (QObject *child, series->children()) {
         if (qobject_cast<DeclarativeXYPoint *>(child)) {
             DeclarativeXYPoint *point = qobject_cast<DeclarativeXYPoint *>(child);
-            series->append(point->x(), point->y());
+            points.append(QPointF(point->x(), point->y()));
         } else if (qobject_cast<QVXYModelMapper *>(child)) {
+            series->append(points);
+            points.clear();
             QVXYModelMapper *mapper = qobject_cast<QVXYModelMapper *>(child);
             mapper->setSeries(series);
         } else if (qobject_cast<QHXYModelMapper *>(child)) {
+            series->append(points);
+            points.clear();
             QHXYModelMapper *mapper = qobject_cast<QHXYModelMapper *>(child);
             mapper->setSeries(series);
         }
     }
+    series->append(points);
 }
 
 void DeclarativeXySeries::append(qreal x, qreal y)
@@ -22,6 +22,9 @@ SUBDIRS += \
            qbarcategoryaxis \
            domain \
            chartdataset \
+           chartpresenter \
+           xyminmaxpyramid \
+           splinechartitem \
            qlegend \
            qareaseries \
            cmake \
@@ -41,5 +44,8 @@ qtHaveModule(quick) {
 
 !contains(QT_CONFIG, private_tests): SUBDIRS -= \
     domain \
-    chartdataset
+    chartdataset \
+    chartpresenter \
+    xyminmaxpyramid \
+    splinechartitem
 
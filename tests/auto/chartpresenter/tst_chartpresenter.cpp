@@ -0,0 +1,272 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <QtGui/QTextDocument>
+#include <QtWidgets/QGraphicsTextItem>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <private/chartpresenter_p.h>
+#include <private/charttextitem_p.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_ChartPresenter: public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void textBoundingRect_data();
+    void textBoundingRect();
+    void isPlainText_data();
+    void isPlainText();
+    void documentText_data();
+    void documentText();
+    void truncatedText();
+    void ellipsisLabels();
+
+private:
+    static QRectF documentBoundingRect(const QFont &font, const QString &text);
+    static QList<ChartTextItem *> horizontalAxisLabels(QChart *chart);
+};
+
+// Measures the text the way the labels lay it out, as a rich text document
+QRectF tst_ChartPresenter::documentBoundingRect(const QFont &font, const QString &text)
+{
+    QGraphicsTextItem textItem;
+    textItem.document()->setDocumentMargin(ChartPresenter::textMargin());
+    textItem.setFont(font);
+    textItem.setHtml(text);
+    return textItem.boundingRect();
+}
+
+// Returns the label items below the plot area, ordered by their position
+QList<ChartTextItem *> tst_ChartPresenter::horizontalAxisLabels(QChart *chart)
+{
+    QList<ChartTextItem *> labels;
+    const QList<QGraphicsItem *> items = chart->scene()->items();
+    for (QGraphicsItem *item : items) {
+        ChartTextItem *textItem = qgraphicsitem_cast<ChartTextItem *>(item);
+        if (textItem && textItem->sceneBoundingRect().top() >= chart->plotArea().bottom())
+            labels.append(textItem);
+    }
+    std::sort(labels.begin(), labels.end(), [](ChartTextItem *a, ChartTextItem *b) {
+        return a->scenePos().x() < b->scenePos().x();
+    });
+    return labels;
+}
+
+void tst_ChartPresenter::init()
+{
+    ChartPresenter::clearTextCache();
+}
+
+void tst_ChartPresenter::textBoundingRect_data()
+{
+    QTest::addColumn<QFont>("font");
+    QTest::addColumn<QString>("text");
+
+    QFont bold;
+    bold.setBold(true);
+    bold.setPointSize(14);
+    QFont italic;
+    italic.setItalic(true);
+    italic.setPixelSize(9);
+    QFont large;
+    large.setPointSize(32);
+
+    const QList<QPair<const char *, QFont> > fonts = {
+        { "default", QFont() }, { "bold", bold }, { "italic", italic }, { "large", large }
+    };
+    const QStringList texts = {
+        QStringLiteral("0"), QStringLiteral("-1.25e+06"), QStringLiteral("Jan 2020"),
+        QStringLiteral("Total revenue (EUR)"), QStringLiteral("WWWWiiii")
+    };
+    for (const auto &font : fonts) {
+        for (const QString &text : texts) {
+            QTest::newRow(qPrintable(QStringLiteral("%1 %2").arg(QLatin1String(font.first), text)))
+                    << font.second << text;
+        }
+    }
+}
+
+void tst_ChartPresenter::textBoundingRect()
+{
+    QFETCH(QFont, font);
+    QFETCH(QString, text);
+
+    // Plain text is measured from the font metrics instead of a text document
+    QVERIFY(ChartPresenter::isPlainText(text));
+    const QRectF rect = ChartPresenter::textBoundingRect(font, text);
+    const QRectF expected = documentBoundingRect(font, text);
+    QVERIFY2(qAbs(rect.width() - expected.width()) <= 1.0,
+             qPrintable(QStringLiteral("%1 != %2").arg(rect.width()).arg(expected.width())));
+    QVERIFY2(qAbs(rect.height() - expected.height()) <= 1.0,
+             qPrintable(QStringLiteral("%1 != %2").arg(rect.height()).arg(expected.height())));
+
+    // The rotated rect is the bounding rect of the rotated text
+    const QRectF rotated = ChartPresenter::textBoundingRect(font, text, 90);
+    QCOMPARE(rotated.width(), rect.height());
+    QCOMPARE(rotated.height(), rect.width());
+}
+
+void tst_ChartPresenter::isPlainText_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<bool>("plain");
+
+    QTest::newRow("plain") << QStringLiteral("Axis title") << true;
+    QTest::newRow("number") << QStringLiteral("-3.5") << true;
+    QTest::newRow("empty") << QString() << false;
+    QTest::newRow("markup") << QStringLiteral("<b>Bold</b>") << false;
+    QTest::newRow("line break") << QStringLiteral("First<br>Second") << false;
+    QTest::newRow("named entity") << QStringLiteral("a &amp; b") << false;
+    QTest::newRow("numeric entity") << QStringLiteral("10&#176;C") << false;
+    QTest::newRow("leading space") << QStringLiteral(" a") << false;
+    QTest::newRow("trailing space") << QStringLiteral("a ") << false;
+    QTest::newRow("double space") << QStringLiteral("a  b") << false;
+    QTest::newRow("tab") << QStringLiteral("a\tb") << false;
+    QTest::newRow("newline") << QStringLiteral("a\nb") << false;
+}
+
+void tst_ChartPresenter::isPlainText()
+{
+    QFETCH(QString, text);
+    QFETCH(bool, plain);
+
+    QCOMPARE(ChartPresenter::isPlainText(text), plain);
+}
+
+void tst_ChartPresenter::documentText_data()
+{
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("bold") << QStringLiteral("<b>Bold</b>");
+    QTest::newRow("line break") << QStringLiteral("First<br>Second");
+    QTest::newRow("subscript") << QStringLiteral("x<sub>1</sub>");
+    QTest::newRow("named entity") << QStringLiteral("a &amp; b");
+    QTest::newRow("numeric entity") << QStringLiteral("10&#176;C");
+    QTest::newRow("collapsed spaces") << QStringLiteral("a    b");
+}
+
+void tst_ChartPresenter::documentText()
+{
+    QFETCH(QString, text);
+
+    // Markup and entities are measured from the text document as they are laid out
+    QFont font;
+    font.setPointSize(12);
+    QCOMPARE(ChartPresenter::textBoundingRect(font, text), documentBoundingRect(font, text));
+}
+
+void tst_ChartPresenter::truncatedText()
+{
+    QFont font;
+    const QString text = QStringLiteral("A label that does not fit into the space of the axis");
+    const qreal maxWidth = ChartPresenter::textBoundingRect(font, text).width() / 3;
+    const qreal maxHeight = 100;
+    ChartPresenter::clearTextCache();
+    QCOMPARE(ChartPresenter::textCacheHitCount(), 0);
+    QCOMPARE(ChartPresenter::textCacheMissCount(), 0);
+
+    QRectF boundingRect;
+    const QString truncated = ChartPresenter::truncatedText(font, text, 0, maxWidth, maxHeight,
+                                                            boundingRect);
+    QVERIFY(truncated.endsWith(QLatin1String("...")));
+    QVERIFY(truncated.length() < text.length());
+    QVERIFY(boundingRect.width() <= maxWidth);
+    const int misses = ChartPresenter::textCacheMissCount();
+    QVERIFY(misses > 1);
+
+    // Truncating the same text again is answered from the cache
+    const int hits = ChartPresenter::textCacheHitCount();
+    QRectF cachedBoundingRect;
+    QCOMPARE(ChartPresenter::truncatedText(font, text, 0, maxWidth, maxHeight,
+                                           cachedBoundingRect), truncated);
+    QCOMPARE(cachedBoundingRect, boundingRect);
+    QCOMPARE(ChartPresenter::textCacheMissCount(), misses);
+    QCOMPARE(ChartPresenter::textCacheHitCount(), hits + misses);
+
+    // The same text in another font is measured again
+    QFont bold = font;
+    bold.setBold(true);
+    ChartPresenter::truncatedText(bold, text, 0, maxWidth, maxHeight, boundingRect);
+    QVERIFY(ChartPresenter::textCacheMissCount() > misses);
+
+    // Clearing the cache resets the counts
+    ChartPresenter::clearTextCache();
+    QCOMPARE(ChartPresenter::textCacheHitCount(), 0);
+    QCOMPARE(ChartPresenter::textCacheMissCount(), 0);
+}
+
+void tst_ChartPresenter::ellipsisLabels()
+{
+    QChartView view;
+    view.resize(200, 200);
+    QChart *chart = view.chart();
+    QLineSeries *series = new QLineSeries();
+    *series << QPointF(0, 0) << QPointF(10, 10);
+    chart->addSeries(series);
+    chart->createDefaultAxes();
+    QValueAxis *axis = qobject_cast<QValueAxis *>(chart->axes(Qt::Horizontal).value(0));
+    QVERIFY(axis);
+    axis->setTickCount(21);
+    axis->setLabelFormat("%.3f");
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QTest::qWait(200);
+
+    // Labels that are truncated down to an ellipsis are hidden where they overlap
+    QList<ChartTextItem *> labels = horizontalAxisLabels(chart);
+    QCOMPARE(labels.count(), 21);
+    QList<bool> visible;
+    int hiddenEllipses = 0;
+    for (ChartTextItem *label : labels) {
+        QVERIFY(!label->isStaticText());
+        visible.append(label->isVisible());
+        if (label->text() == QLatin1String("...") && !label->isVisible())
+            hiddenEllipses++;
+    }
+    QVERIFY(hiddenEllipses > 0);
+
+    // The same labels are hidden when they are drawn as static text
+    chart->setPlainTextLabels(true);
+    QTest::qWait(200);
+    labels = horizontalAxisLabels(chart);
+    QCOMPARE(labels.count(), visible.count());
+    for (int i = 0; i < labels.count(); i++) {
+        QVERIFY(labels.at(i)->isStaticText());
+        QCOMPARE(labels.at(i)->toPlainText(), QString());
+        QCOMPARE(labels.at(i)->isVisible(), visible.at(i));
+    }
+}
+
+QTEST_MAIN(tst_ChartPresenter)
+#include "tst_chartpresenter.moc"
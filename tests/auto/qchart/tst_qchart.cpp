@@ -38,6 +38,7 @@
 #include <QtCharts/QBarSeries>
 #include <QtCharts/QPercentBarSeries>
 #include <QtCharts/QStackedBarSeries>
+#include <QtCharts/QBarSet>
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QBarCategoryAxis>
 #include <QtCharts/QDateTimeAxis>
@@ -72,6 +73,7 @@ private slots:
     void animationOptions_data();
     void animationOptions();
     void animationDuration();
+    void animationPointLimit();
     void animationCurve_data();
     void animationCurve();
     void axisX_data();
@@ -126,6 +128,10 @@ private slots:
     void zoomInAndOut_data();
     void zoomInAndOut();
     void fixedPlotArea();
+    void nearestPointIndex();
+    void deferredUpdates();
+    void plainTextLabels();
+    void timings();
 private:
     void createTestData();
 
@@ -181,6 +187,8 @@ void tst_QChart::qchart()
     QCOMPARE(m_chart->animationOptions(), QChart::NoAnimation);
     QCOMPARE(m_chart->animationDuration(), 1000);
     QCOMPARE(m_chart->animationEasingCurve(), QEasingCurve(QEasingCurve::OutQuart));
+    QCOMPARE(m_chart->animationPointLimit(), 10000);
+    QCOMPARE(m_chart->plainTextLabels(), false);
     QVERIFY(m_chart->axes(Qt::Horizontal).isEmpty());
     QVERIFY(m_chart->axes(Qt::Vertical).isEmpty());
     QVERIFY(m_chart->backgroundBrush()!=QBrush());
@@ -286,6 +294,30 @@ void tst_QChart::animationDuration()
     QVERIFY(m_chart->animationDuration() == 2000);
 }
 
+void tst_QChart::animationPointLimit()
+{
+    QCOMPARE(m_chart->animationPointLimit(), 10000);
+    m_chart->setAnimationPointLimit(-1);
+    QCOMPARE(m_chart->animationPointLimit(), 0);
+
+    QLineSeries *series = new QLineSeries();
+    for (int i = 0; i < 20; i++)
+        series->append(i, 0);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_chart->axes(Qt::Vertical).first()->setRange(0, 10);
+    m_chart->setAnimationOptions(QChart::SeriesAnimations);
+    m_chart->setAnimationDuration(10000);
+    m_chart->setAnimationPointLimit(10);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    // The series has more points than the limit, so the change is applied without animation
+    series->replace(5, 5, 8);
+    QTest::qWait(50);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(5, 8), series), 1), 5);
+}
+
 void tst_QChart::animationCurve_data()
 {
     QTest::addColumn<QEasingCurve>("animationCurve");
@@ -1229,6 +1261,185 @@ void tst_QChart::fixedPlotArea()
     QCOMPARE(m_chart->plotArea(), originalPlotArea);
 }
 
+void tst_QChart::nearestPointIndex()
+{
+    QLineSeries *line = new QLineSeries();
+    QScatterSeries *scatter = new QScatterSeries();
+    for (int i = 0; i <= 10; i++) {
+        line->append(i, i);
+        scatter->append(i, 10 - i);
+    }
+    m_chart->addSeries(line);
+    m_chart->addSeries(scatter);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    QXYSeries *series = nullptr;
+    QCOMPARE(m_chart->nearestPointIndex(m_chart->mapToPosition(QPointF(3, 3), line), &series), 3);
+    QCOMPARE(series, line);
+    QCOMPARE(line->nearestPointIndex(m_chart->mapToPosition(QPointF(3, 3), line)), 3);
+    QCOMPARE(m_chart->nearestPointIndex(m_chart->mapToPosition(QPointF(2, 8), scatter), &series), 2);
+    QCOMPARE(series, scatter);
+
+    // Out of reach
+    const QPointF farAway = m_chart->mapToPosition(QPointF(2, 8), scatter) + QPointF(1000, 1000);
+    QCOMPARE(m_chart->nearestPointIndex(farAway, &series, 10), -1);
+    QVERIFY(!series);
+    QVERIFY(m_chart->nearestPointIndex(farAway, &series) >= 0);
+
+    // Hidden series are skipped
+    scatter->setVisible(false);
+    QCOMPARE(m_chart->nearestPointIndex(m_chart->mapToPosition(QPointF(2, 8), scatter), &series, 5), -1);
+    QCOMPARE(m_chart->nearestPointIndex(m_chart->mapToPosition(QPointF(3, 3), line), &series, 5), 3);
+    QCOMPARE(series, line);
+
+    // Series without a chart
+    QLineSeries detached;
+    detached.append(1, 1);
+    QCOMPARE(detached.nearestPointIndex(QPointF(0, 0)), -1);
+}
+
+void tst_QChart::deferredUpdates()
+{
+    QCOMPARE(m_chart->deferredUpdates(), false);
+    QCOMPARE(m_chart->maximumUpdateRate(), 0);
+
+    QLineSeries *series = new QLineSeries();
+    series->append(0, 0);
+    series->append(10, 10);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    m_chart->setDeferredUpdates(true);
+    m_chart->setMaximumUpdateRate(-1);
+    QCOMPARE(m_chart->maximumUpdateRate(), 0);
+
+    // The geometry is not updated until the event loop runs
+    series->replace(1, 5, 5);
+    series->append(8, 2);
+    const QPointF position = m_chart->mapToPosition(QPointF(5, 5), series);
+    QCOMPARE(series->nearestPointIndex(position, 1), -1);
+    QTRY_COMPARE(series->nearestPointIndex(position, 1), 1);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(8, 2), series), 1), 2);
+
+    // Many changes made before the event loop runs are applied in a single pass
+    QTRY_COMPARE(m_chart->updatePassCount(), 1);
+    m_chart->resetUpdateCounters();
+    QCOMPARE(m_chart->updateRequestCount(), 0);
+    QCOMPARE(m_chart->coalescedUpdateCount(), 0);
+    QCOMPARE(m_chart->updatePassCount(), 0);
+    for (int i = 0; i < 20; i++)
+        series->replace(2, 8, i * 0.25);
+    QCOMPARE(m_chart->updatePassCount(), 0);
+    QCOMPARE(m_chart->updateRequestCount(), 20);
+    QCOMPARE(m_chart->coalescedUpdateCount(), 19);
+    QTRY_COMPARE(m_chart->updatePassCount(), 1);
+    QTest::qWait(50);
+    QCOMPARE(m_chart->updatePassCount(), 1);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(8, 4.75), series), 1), 2);
+
+    // Disabling deferred updates applies the pending changes
+    series->replace(1, 6, 6);
+    m_chart->setDeferredUpdates(false);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(6, 6), series), 1), 1);
+
+    // Removing a series with a pending update
+    m_chart->setDeferredUpdates(true);
+    m_chart->setMaximumUpdateRate(10);
+    QCOMPARE(m_chart->maximumUpdateRate(), 10);
+    series->append(9, 9);
+    m_chart->removeSeries(series);
+    delete series;
+    QTest::qWait(200);
+}
+
+void tst_QChart::plainTextLabels()
+{
+    QLineSeries *series = new QLineSeries();
+    *series << QPointF(0, 0) << QPointF(10, 10);
+    QBarSeries *barSeries = new QBarSeries();
+    QBarSet *set = new QBarSet("set");
+    *set << 1 << 2 << 3;
+    barSeries->append(set);
+    barSeries->setLabelsVisible(true);
+    m_chart->addSeries(series);
+    m_chart->addSeries(barSeries);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    const QRectF plotArea = m_chart->plotArea();
+    m_chart->setPlainTextLabels(true);
+    QCOMPARE(m_chart->plainTextLabels(), true);
+    QTest::qWait(200);
+    QCOMPARE(m_chart->plotArea(), plotArea);
+
+    // Labels with markup are still laid out as rich text
+    QValueAxis *axis = qobject_cast<QValueAxis *>(m_chart->axes(Qt::Vertical).value(0));
+    QVERIFY(axis);
+    axis->setLabelFormat("<b>%.1f</b>");
+    axis->setLabelsEditable(true);
+    QTest::qWait(200);
+
+    m_chart->setPlainTextLabels(false);
+    QCOMPARE(m_chart->plainTextLabels(), false);
+    QTest::qWait(200);
+}
+
+void tst_QChart::timings()
+{
+    QCOMPARE(m_chart->isTimingEnabled(), false);
+    QCOMPARE(m_chart->timedFrameCount(), 0);
+    QCOMPARE(m_chart->lastFrameTime(QChart::PaintTiming), qint64(0));
+
+    QLineSeries *series = new QLineSeries();
+    for (int i = 0; i < 100; i++)
+        series->append(i, i % 7);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    QSignalSpy spy(m_chart, SIGNAL(timingRecorded(QChart::TimingCategory,qint64)));
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    // Nothing is recorded while timing is disabled
+    series->replace(0, 0, 3);
+    m_view->repaint();
+    QCOMPARE(spy.count(), 0);
+    QCOMPARE(m_chart->timedFrameCount(), 0);
+
+    m_chart->setTimingEnabled(true);
+    QCOMPARE(m_chart->isTimingEnabled(), true);
+    m_chart->resize(m_chart->size() + QSizeF(10, 10));
+    series->replace(0, 0, 4);
+    m_view->repaint();
+    QTRY_VERIFY(m_chart->timedFrameCount() > 0);
+    QVERIFY(spy.count() > 0);
+    for (int category = QChart::LayoutTiming; category <= QChart::PaintTiming; category++) {
+        const QChart::TimingCategory timingCategory = QChart::TimingCategory(category);
+        QVERIFY(m_chart->maximumFrameTime(timingCategory) >= m_chart->averageFrameTime(timingCategory));
+        QVERIFY(m_chart->maximumFrameTime(timingCategory) >= m_chart->lastFrameTime(timingCategory));
+    }
+    QVERIFY(m_chart->lastFrameTime(QChart::PaintTiming) > 0);
+
+    // The statistics are kept over a window of frames
+    for (int i = 0; i < 70; i++)
+        m_view->repaint();
+    QCOMPARE(m_chart->timedFrameCount(), 60);
+
+    m_chart->resetTimings();
+    QCOMPARE(m_chart->timedFrameCount(), 0);
+    QCOMPARE(m_chart->maximumFrameTime(QChart::PaintTiming), qint64(0));
+
+    m_chart->setTimingEnabled(false);
+    spy.clear();
+    m_view->repaint();
+    QCOMPARE(spy.count(), 0);
+    QCOMPARE(m_chart->timedFrameCount(), 0);
+}
+
 QTEST_MAIN(tst_QChart)
 #include "tst_qchart.moc"
 
@@ -29,6 +29,7 @@
 
 #include "../qxyseries/tst_qxyseries.h"
 #include <QtCharts/QLineSeries>
+#include <QtCore/QtMath>
 
 Q_DECLARE_METATYPE(QList<QPointF>)
 
@@ -48,6 +49,8 @@ private slots:
     void releasedSignal();
     void doubleClickedSignal();
     void insert();
+    void decimationMode();
+    void minMaxSummary();
 protected:
     void pointsVisible_data();
 };
@@ -236,6 +239,86 @@ void tst_QLineSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(linePoint.y()));
 }
 
+void tst_QLineSeries::decimationMode()
+{
+    QLineSeries *lineSeries = new QLineSeries();
+    QCOMPARE(lineSeries->decimationMode(), QLineSeries::NoDecimation);
+
+    QSignalSpy spy(lineSeries, SIGNAL(decimationModeChanged(QLineSeries::DecimationMode)));
+    lineSeries->setDecimationMode(QLineSeries::MinMaxDecimation);
+    QCOMPARE(lineSeries->decimationMode(), QLineSeries::MinMaxDecimation);
+    QCOMPARE(spy.count(), 1);
+    lineSeries->setDecimationMode(QLineSeries::MinMaxDecimation);
+    QCOMPARE(spy.count(), 1);
+
+    QVector<QPointF> points;
+    points.reserve(100000);
+    for (int i = 0; i < 100000; i++)
+        points.append(QPointF(i, qSin(i / 100.0)));
+    lineSeries->replace(points);
+
+    QChartView view;
+    view.resize(200, 200);
+    view.chart()->addSeries(lineSeries);
+    view.chart()->createDefaultAxes();
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    // Decimation affects drawing only, the series data is left intact
+    view.chart()->zoomIn();
+    lineSeries->setDecimationMode(QLineSeries::LttbDecimation);
+    lineSeries->append(100000, 0);
+    QCOMPARE(lineSeries->count(), 100001);
+    lineSeries->setPointsVisible(true);
+    lineSeries->setDecimationMode(QLineSeries::NoDecimation);
+    QCOMPARE(spy.count(), 3);
+    QCOMPARE(lineSeries->pointsVector().first(), points.first());
+}
+
+void tst_QLineSeries::minMaxSummary()
+{
+    QLineSeries *lineSeries = new QLineSeries();
+    lineSeries->setDecimationMode(QLineSeries::MinMaxDecimation);
+
+    QVector<QPointF> points;
+    points.reserve(200000);
+    for (int i = 0; i < 200000; i++)
+        points.append(QPointF(i, qSin(i / 100.0)));
+    lineSeries->replace(points);
+
+    QChartView view;
+    view.resize(400, 200);
+    view.chart()->addSeries(lineSeries);
+    view.chart()->createDefaultAxes();
+    view.chart()->axes(Qt::Horizontal).first()->setRange(0, 400000);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    // Appended points extend the summary, other changes rebuild it
+    QList<QPointF> appended;
+    for (int i = 200000; i < 300000; i++)
+        appended.append(QPointF(i, 2 * qSin(i / 100.0)));
+    lineSeries->append(appended);
+    lineSeries->append(300000, 5);
+    QCOMPARE(lineSeries->count(), 300001);
+    QTest::qWait(50);
+    view.chart()->zoomIn();
+    view.chart()->zoomOut();
+
+    lineSeries->replace(100, QPointF(100, -5));
+    lineSeries->removePoints(0, 50);
+    lineSeries->insert(0, QPointF(-1, 0));
+    QCOMPARE(lineSeries->count(), 299952);
+    QCOMPARE(lineSeries->at(51), QPointF(100, -5));
+    QTest::qWait(50);
+
+    lineSeries->setCapacity(1000);
+    lineSeries->append(300001, 0);
+    QCOMPARE(lineSeries->count(), 1000);
+    lineSeries->setDecimationMode(QLineSeries::NoDecimation);
+    QTest::qWait(50);
+}
+
 QTEST_MAIN(tst_QLineSeries)
 
 #include "tst_qlineseries.moc"
@@ -0,0 +1,177 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.0
+import QtTest 1.0
+import QtCharts 2.15
+
+Rectangle {
+    width: 800
+    height: 300
+
+    TestCase {
+        id: tc1
+        name: "tst_qml-qtquicktest ChartView Properties 2.15"
+        when: windowShown
+
+        function test_chartViewProperties() {
+            compare(chartView.threadedRendering, false, "ChartView.threadedRendering");
+            compare(chartView.timingEnabled, false, "ChartView.timingEnabled");
+            compare(chartView.timedFrameCount(), 0, "ChartView.timedFrameCount");
+        }
+
+        function test_threadedRendering() {
+            threadedRenderingSpy.clear();
+            chartView.threadedRendering = true;
+            compare(chartView.threadedRendering, true, "ChartView.threadedRendering");
+            compare(threadedRenderingSpy.count, 1, "ChartView.threadedRenderingChanged");
+            chartView.threadedRendering = true;
+            compare(threadedRenderingSpy.count, 1, "ChartView.threadedRenderingChanged");
+
+            // The chart rendered on the worker thread looks the same as the one rendered on the
+            // GUI thread
+            crossingSeries.replace(0, 4.5, 4);
+            crossingSeries.replace(1, 5.5, 6);
+            waitForRendering(chartView);
+            crossingSeries.replace(0, 4, 5.5);
+            crossingSeries.replace(1, 6, 4.5);
+            waitForRendering(chartView);
+            tryVerify(function() {
+                return grabImage(chartView).equals(grabImage(referenceChartView));
+            }, 5000, "Chart rendered on the worker thread differs from the reference");
+
+            chartView.threadedRendering = false;
+            compare(chartView.threadedRendering, false, "ChartView.threadedRendering");
+            compare(threadedRenderingSpy.count, 2, "ChartView.threadedRenderingChanged");
+        }
+
+        function test_timing() {
+            timingEnabledSpy.clear();
+            timingRecordedSpy.clear();
+            chartView.timingEnabled = true;
+            compare(chartView.timingEnabled, true, "ChartView.timingEnabled");
+            compare(timingEnabledSpy.count, 1, "ChartView.timingEnabledChanged");
+
+            crossingSeries.append(5, 5);
+            timingRecordedSpy.wait();
+            tryVerify(function() { return chartView.timedFrameCount() > 0; }, 5000,
+                      "ChartView.timedFrameCount");
+            verify(chartView.lastFrameTime(ChartView.LayoutTiming) >= 0);
+            verify(chartView.averageFrameTime(ChartView.PaintTiming) >= 0);
+            verify(chartView.maximumFrameTime(ChartView.PaintTiming)
+                   >= chartView.averageFrameTime(ChartView.PaintTiming));
+
+            chartView.resetTimings();
+            compare(chartView.timedFrameCount(), 0, "ChartView.timedFrameCount");
+            crossingSeries.remove(2);
+
+            chartView.timingEnabled = false;
+            compare(chartView.timingEnabled, false, "ChartView.timingEnabled");
+            compare(timingEnabledSpy.count, 2, "ChartView.timingEnabledChanged");
+        }
+
+        function test_partialRendering() {
+            waitForRendering(chartView);
+
+            // Only the part of the series layer around the crossing series is rendered again
+            crossingSeries.replace(0, 4, 5.5);
+            crossingSeries.replace(1, 6, 4.5);
+            waitForRendering(chartView);
+
+            tryVerify(function() {
+                return grabImage(chartView).equals(grabImage(referenceChartView));
+            }, 5000, "Partially rendered chart differs from the fully rendered one");
+        }
+    }
+
+    ChartView {
+        id: chartView
+        x: 0
+        width: 400
+        height: 300
+        legend.visible: false
+
+        SignalSpy {
+            id: threadedRenderingSpy
+            target: chartView
+            signalName: "threadedRenderingChanged"
+        }
+        SignalSpy {
+            id: timingEnabledSpy
+            target: chartView
+            signalName: "timingEnabledChanged"
+        }
+        SignalSpy {
+            id: timingRecordedSpy
+            target: chartView
+            signalName: "timingRecorded"
+        }
+
+        ValueAxis { id: axisX; min: 0; max: 10 }
+        ValueAxis { id: axisY; min: 0; max: 10 }
+
+        LineSeries {
+            axisX: axisX
+            axisY: axisY
+            XYPoint { x: 0; y: 0 }
+            XYPoint { x: 10; y: 10 }
+        }
+        LineSeries {
+            id: crossingSeries
+            axisX: axisX
+            axisY: axisY
+            XYPoint { x: 4.5; y: 4 }
+            XYPoint { x: 5.5; y: 6 }
+        }
+    }
+
+    ChartView {
+        id: referenceChartView
+        x: 400
+        width: 400
+        height: 300
+        legend.visible: false
+
+        ValueAxis { id: referenceAxisX; min: 0; max: 10 }
+        ValueAxis { id: referenceAxisY; min: 0; max: 10 }
+
+        LineSeries {
+            axisX: referenceAxisX
+            axisY: referenceAxisY
+            XYPoint { x: 0; y: 0 }
+            XYPoint { x: 10; y: 10 }
+        }
+        LineSeries {
+            axisX: referenceAxisX
+            axisY: referenceAxisY
+            XYPoint { x: 4; y: 5.5 }
+            XYPoint { x: 6; y: 4.5 }
+        }
+    }
+}
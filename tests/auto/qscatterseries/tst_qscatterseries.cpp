@@ -48,6 +48,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void batchedRendering();
 
 protected:
     void pointsVisible_data();
@@ -235,6 +236,63 @@ void tst_QScatterSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(scatterPoint.y()));
 }
 
+void tst_QScatterSeries::batchedRendering()
+{
+    QScatterSeries *series = qobject_cast<QScatterSeries *>(m_series);
+    QVERIFY(series);
+
+    QSignalSpy batchedSpy(series, SIGNAL(batchedRenderingChanged(bool)));
+    QCOMPARE(series->batchedRendering(), false);
+    series->setBatchedRendering(true);
+    series->setBatchedRendering(true);
+    TRY_COMPARE(batchedSpy.count(), 1);
+    QCOMPARE(series->batchedRendering(), true);
+
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QPointF scatterPoint(4, 12);
+    QScatterSeries *scatterSeries = new QScatterSeries();
+    scatterSeries->setBatchedRendering(true);
+    scatterSeries->append(QPointF(2, 1));
+    scatterSeries->append(scatterPoint);
+    scatterSeries->append(QPointF(6, 12));
+
+    QChartView view;
+    view.resize(200, 200);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(scatterSeries);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy pressedSpy(scatterSeries, SIGNAL(pressed(QPointF)));
+    QSignalSpy releasedSpy(scatterSeries, SIGNAL(released(QPointF)));
+    QSignalSpy clickedSpy(scatterSeries, SIGNAL(clicked(QPointF)));
+
+    // The markers are painted, hit-testing finds the marker under the cursor
+    QPointF checkPoint = view.chart()->mapToPosition(scatterPoint);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QCOMPARE(pressedSpy.count(), 1);
+    QCOMPARE(releasedSpy.count(), 1);
+    QCOMPARE(clickedSpy.count(), 1);
+    QPointF signalPoint = qvariant_cast<QPointF>(clickedSpy.takeFirst().at(0));
+    QCOMPARE(signalPoint, scatterPoint);
+
+    // Clicking next to the markers does nothing
+    checkPoint = view.chart()->mapToPosition(QPointF(4, 1));
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(clickedSpy.count(), 0);
+
+    // Switching back to marker items keeps the signals working
+    scatterSeries->setBatchedRendering(false);
+    checkPoint = view.chart()->mapToPosition(scatterPoint);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, {}, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(clickedSpy.count(), 1);
+}
+
 QTEST_MAIN(tst_QScatterSeries)
 
 #include "tst_qscatterseries.moc"
@@ -47,6 +47,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void splineType();
 protected:
     void pointsVisible_data();
 };
@@ -205,6 +206,47 @@ void tst_QSplineSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.x()), qRound(splinePoint.x()));
     QCOMPARE(qRound(signalPoint.y()), qRound(splinePoint.y()));
 }
+
+void tst_QSplineSeries::splineType()
+{
+    QSplineSeries *series = new QSplineSeries();
+    QCOMPARE(series->splineType(), QSplineSeries::NaturalSpline);
+    QSignalSpy spy(series, SIGNAL(splineTypeChanged(QSplineSeries::SplineType)));
+
+    for (int i = 0; i < 1000; i++)
+        series->append(i, (i * 7) % 13);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    series->setSplineType(QSplineSeries::MonotoneSpline);
+    QCOMPARE(series->splineType(), QSplineSeries::MonotoneSpline);
+    QCOMPARE(spy.count(), 1);
+    series->setSplineType(QSplineSeries::MonotoneSpline);
+    QCOMPARE(spy.count(), 1);
+
+    // Appended points extend the curve
+    series->append(1000, 5);
+    series->append(1001, 6);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(1001, 6), series), 1), 1001);
+
+    // Only the visible part of the series is mapped to geometry
+    m_chart->axes(Qt::Horizontal).first()->setRange(100, 200);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(150, 10), series), 1), 150);
+    series->append(1002, 7);
+    series->replace(150, 150, 8);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(150, 8), series), 1), 150);
+
+    series->setSplineType(QSplineSeries::CatmullRomSpline);
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(120, 8), series), 1), 120);
+
+    series->setSplineType(QSplineSeries::NaturalSpline);
+    QCOMPARE(series->nearestPointIndex(m_chart->mapToPosition(QPointF(120, 8), series), 1), 120);
+    QTest::qWait(100);
+}
+
 QTEST_MAIN(tst_QSplineSeries)
 
 #include "tst_qsplineseries.moc"
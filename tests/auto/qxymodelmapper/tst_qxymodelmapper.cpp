@@ -348,6 +348,13 @@ void tst_qxymodelmapper::seriesUpdated()
     m_series->replace(m_series->points().first(), QPointF(25.0, 75.0));
     QCOMPARE(m_model->data(m_model->index(0, 0)).toReal(), 25.0);
     QCOMPARE(m_model->data(m_model->index(0, 1)).toReal(), 75.0);
+
+    m_series->insert(1, QList<QPointF>() << QPointF(200, 201) << QPointF(300, 301));
+    QCOMPARE(m_series->count(), 6);
+    QCOMPARE(m_model->rowCount(), 6);
+    QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 200.0);
+    QCOMPARE(m_model->data(m_model->index(2, 1)).toReal(), 301.0);
+    QCOMPARE(m_vMapper->rowCount(), -1);
 }
 
 void tst_qxymodelmapper::verticalModelInsertRows()
@@ -32,8 +32,11 @@
 
 #include <QtTest/QtTest>
 #include <QtCharts/QXYSeries>
+#include <QtCharts/QXYDataSource>
+#include <QtCharts/QLineSeries>
 #include <QtCharts/QChartView>
 #include <QtGui/QStandardItemModel>
+#include <QtCore/QTemporaryFile>
 #include <tst_definitions.h>
 
 QT_CHARTS_USE_NAMESPACE
@@ -93,6 +96,14 @@ private slots:
     void replace_chart_animation();
     void insert_data();
     void insert();
+    void appendPoints_data();
+    void appendPoints();
+    void insertPoints_data();
+    void insertPoints();
+    void capacity_data();
+    void capacity();
+    void dataSource();
+    void fileDataSource();
     void changedSignals();
 protected:
     void append_data();
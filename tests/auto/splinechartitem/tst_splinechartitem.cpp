@@ -0,0 +1,182 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <QtCharts/QChartView>
+#include <QtCharts/QSplineSeries>
+#include <QtCharts/QValueAxis>
+#include <private/splinechartitem_p.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Gives the test access to a full control point calculation for a spline type
+class ReferenceSplineItem : public SplineChartItem
+{
+public:
+    ReferenceSplineItem(QSplineSeries *series) : SplineChartItem(series) {}
+    using SplineChartItem::calculateLocalControlPoints;
+};
+
+class tst_SplineChartItem: public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void appendedControlPoints_data();
+    void appendedControlPoints();
+    void monotoneControlPoints();
+
+private:
+    static SplineChartItem *splineChartItem(QChart *chart);
+    static QVector<QPointF> fullControlPoints(QSplineSeries::SplineType type,
+                                              const QVector<QPointF> &points);
+    static bool withinSegments(const QVector<QPointF> &points,
+                               const QVector<QPointF> &controlPoints);
+};
+
+SplineChartItem *tst_SplineChartItem::splineChartItem(QChart *chart)
+{
+    const QList<QGraphicsItem *> items = chart->scene()->items();
+    for (QGraphicsItem *item : items) {
+        if (SplineChartItem *splineItem = qobject_cast<SplineChartItem *>(item->toGraphicsObject()))
+            return splineItem;
+    }
+    return nullptr;
+}
+
+QVector<QPointF> tst_SplineChartItem::fullControlPoints(QSplineSeries::SplineType type,
+                                                        const QVector<QPointF> &points)
+{
+    QSplineSeries series;
+    series.setSplineType(type);
+    ReferenceSplineItem reference(&series);
+    QVector<QPointF> controlPoints;
+    reference.calculateLocalControlPoints(points, controlPoints, 0);
+    return controlPoints;
+}
+
+// Returns true if the control points of each segment lie within the y-range of its end points
+bool tst_SplineChartItem::withinSegments(const QVector<QPointF> &points,
+                                         const QVector<QPointF> &controlPoints)
+{
+    const qreal epsilon = 1e-9;
+    for (int i = 0; i < points.size() - 1; i++) {
+        const qreal minY = qMin(points.at(i).y(), points.at(i + 1).y()) - epsilon;
+        const qreal maxY = qMax(points.at(i).y(), points.at(i + 1).y()) + epsilon;
+        for (int j = 2 * i; j <= 2 * i + 1; j++) {
+            const qreal y = controlPoints.at(j).y();
+            if (y < minY || y > maxY)
+                return false;
+        }
+    }
+    return true;
+}
+
+void tst_SplineChartItem::appendedControlPoints_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::newRow("catmull-rom") << int(QSplineSeries::CatmullRomSpline);
+    QTest::newRow("monotone") << int(QSplineSeries::MonotoneSpline);
+}
+
+void tst_SplineChartItem::appendedControlPoints()
+{
+    QFETCH(int, type);
+    const QSplineSeries::SplineType splineType = QSplineSeries::SplineType(type);
+
+    QChartView view;
+    QSplineSeries *series = new QSplineSeries();
+    series->setSplineType(splineType);
+    for (int i = 0; i < 100; i++)
+        series->append(i, (i * 7) % 13);
+    view.chart()->addSeries(series);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    axisX->setRange(0, 200);
+    axisY->setRange(-1, 14);
+    view.chart()->addAxis(axisX, Qt::AlignBottom);
+    view.chart()->addAxis(axisY, Qt::AlignLeft);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    view.resize(800, 600);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    SplineChartItem *item = splineChartItem(view.chart());
+    QVERIFY(item);
+    QCOMPARE(item->controlGeometryPoints(),
+             fullControlPoints(splineType, item->geometryPoints()));
+
+    // Single points and blocks of points extend the control points in place
+    for (int i = 100; i < 150; i++)
+        series->append(i, (i * 5) % 11);
+    QList<QPointF> block;
+    for (int i = 150; i < 200; i++)
+        block.append(QPointF(i, (i * 3) % 7));
+    series->append(block);
+
+    const QVector<QPointF> points = item->geometryPoints();
+    QCOMPARE(points.size(), series->count());
+    QCOMPARE(item->controlGeometryPoints(), fullControlPoints(splineType, points));
+}
+
+void tst_SplineChartItem::monotoneControlPoints()
+{
+    QChartView view;
+    QSplineSeries *series = new QSplineSeries();
+    series->setSplineType(QSplineSeries::MonotoneSpline);
+    // Steps, peaks and uneven spacing make a Catmull-Rom spline overshoot
+    const QList<QPointF> points = { { 0, 0 }, { 1, 0 }, { 2, 10 }, { 3, 10 }, { 4, 2 },
+                                    { 4.5, 8 }, { 7, 8.5 }, { 7.2, 0 }, { 9, 1 } };
+    series->append(points);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    view.chart()->axes(Qt::Horizontal).first()->setRange(0, 10);
+    view.resize(800, 600);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    SplineChartItem *item = splineChartItem(view.chart());
+    QVERIFY(item);
+    QVector<QPointF> geometryPoints = item->geometryPoints();
+    QCOMPARE(geometryPoints.size(), points.size());
+    QVERIFY(!withinSegments(geometryPoints,
+                            fullControlPoints(QSplineSeries::CatmullRomSpline, geometryPoints)));
+    QVERIFY(withinSegments(geometryPoints, item->controlGeometryPoints()));
+
+    // The segment before appended points gets a new tangent at its end
+    series->append(9.5, 6);
+    series->append(10, 6);
+    geometryPoints = item->geometryPoints();
+    QCOMPARE(geometryPoints.size(), series->count());
+    QVERIFY(withinSegments(geometryPoints, item->controlGeometryPoints()));
+}
+
+QTEST_MAIN(tst_SplineChartItem)
+
+#include "tst_splinechartitem.moc"
@@ -0,0 +1,193 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <QtCore/QRandomGenerator>
+#include <private/xyminmaxpyramid_p.h>
+#include <private/xydecimator_p.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_XYMinMaxPyramid: public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void minMax_data();
+    void minMax();
+    void removeFirst();
+    void append();
+
+private:
+    static QVector<QPointF> createPoints(int count, bool uneven, quint32 seed);
+    static QVector<qreal> createEdges(qreal minX, qreal maxX, int columns);
+    static QVector<int> decimate(const XYMinMaxPyramid &pyramid, const QVector<QPointF> &points,
+                                 int first, int last, const QVector<qreal> &edges);
+};
+
+// Creates points sorted by x. Uneven points are spaced randomly and contain gaps wider than a
+// pixel column.
+QVector<QPointF> tst_XYMinMaxPyramid::createPoints(int count, bool uneven, quint32 seed)
+{
+    QRandomGenerator generator(seed);
+    QVector<QPointF> points;
+    points.reserve(count);
+    qreal x = 0;
+    for (int i = 0; i < count; ++i) {
+        if (uneven)
+            x += (i % 5000 == 4999) ? 1000 : generator.bounded(2.0);
+        else
+            x += 1;
+        // Repeated y values make the order of equal extrema matter
+        points.append(QPointF(x, generator.bounded(100)));
+    }
+    return points;
+}
+
+QVector<qreal> tst_XYMinMaxPyramid::createEdges(qreal minX, qreal maxX, int columns)
+{
+    QVector<qreal> edges;
+    for (int i = 0; i <= columns; ++i)
+        edges.append(minX + (maxX - minX) * i / columns);
+    return edges;
+}
+
+// Decimates the points from first to last via the pyramid the way XYChart does
+QVector<int> tst_XYMinMaxPyramid::decimate(const XYMinMaxPyramid &pyramid,
+                                            const QVector<QPointF> &points, int first, int last,
+                                            const QVector<qreal> &edges)
+{
+    const QVector<int> candidates = pyramid.minMax(first, last, edges);
+    for (int i = 1; i < candidates.size(); ++i)
+        Q_ASSERT(candidates.at(i - 1) < candidates.at(i));
+
+    QVector<QPointF> candidatePoints;
+    for (int index : candidates)
+        candidatePoints.append(points.at(index));
+    QVector<int> result = XYDecimator::minMax(candidatePoints, 0, candidatePoints.size(), edges);
+    for (int &index : result)
+        index = candidates.at(index);
+    return result;
+}
+
+void tst_XYMinMaxPyramid::minMax_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("uneven");
+    QTest::addColumn<int>("columns");
+    QTest::addColumn<qreal>("minFraction");
+    QTest::addColumn<qreal>("maxFraction");
+
+    QTest::newRow("even, all visible") << 100000 << false << 200 << 0.0 << 1.0;
+    QTest::newRow("even, zoomed") << 100000 << false << 300 << 0.3 << 0.35;
+    QTest::newRow("even, one point per column") << 10000 << false << 10000 << 0.0 << 1.0;
+    QTest::newRow("uneven, all visible") << 100000 << true << 640 << 0.0 << 1.0;
+    QTest::newRow("uneven, zoomed") << 100000 << true << 200 << 0.5 << 0.6;
+    QTest::newRow("single column") << 20000 << false << 1 << 0.0 << 1.0;
+    QTest::newRow("less than a bucket") << 50 << false << 10 << 0.0 << 1.0;
+}
+
+void tst_XYMinMaxPyramid::minMax()
+{
+    QFETCH(int, count);
+    QFETCH(bool, uneven);
+    QFETCH(int, columns);
+    QFETCH(qreal, minFraction);
+    QFETCH(qreal, maxFraction);
+
+    const QVector<QPointF> points = createPoints(count, uneven, 1);
+    XYMinMaxPyramid pyramid;
+    pyramid.append(points.constData(), points.size());
+    QCOMPARE(pyramid.count(), count);
+
+    const qreal span = points.last().x() - points.first().x();
+    const QVector<qreal> edges = createEdges(points.first().x() + span * minFraction,
+                                             points.first().x() + span * maxFraction, columns);
+
+    // The visible range with a neighbour on each side, as well as the whole range
+    int first = 0;
+    int last = 0;
+    XYDecimator::visibleRange(points, edges.first(), edges.last(), first, last);
+    QCOMPARE(decimate(pyramid, points, first, last, edges),
+             XYDecimator::minMax(points, first, last, edges));
+    QCOMPARE(decimate(pyramid, points, 0, count, edges),
+             XYDecimator::minMax(points, 0, count, edges));
+
+    // Ranges that do not start or end at bucket boundaries
+    QCOMPARE(decimate(pyramid, points, 17, count - 33, edges),
+             XYDecimator::minMax(points, 17, count - 33, edges));
+
+    // Dense data is reduced to a few points per column before it is decimated per column
+    if (last - first >= 4 * columns * XYMinMaxPyramid::BaseBucketSize)
+        QVERIFY(pyramid.minMax(first, last, edges).size() < (last - first) / 4);
+}
+
+void tst_XYMinMaxPyramid::removeFirst()
+{
+    const int count = 50000;
+    const QVector<QPointF> points = createPoints(count, true, 2);
+    XYMinMaxPyramid pyramid;
+    pyramid.append(points.constData(), points.size());
+
+    // The indexes count from the first point that is left
+    const int removed = 1000 + 3;
+    pyramid.removeFirst(removed);
+    QCOMPARE(pyramid.count(), count - removed);
+    const QVector<QPointF> remaining = points.mid(removed);
+    const QVector<qreal> edges = createEdges(remaining.first().x(), remaining.last().x(), 400);
+    QCOMPARE(decimate(pyramid, remaining, 0, remaining.size(), edges),
+             XYDecimator::minMax(remaining, 0, remaining.size(), edges));
+
+    // Removing more points than are left clears the summary
+    pyramid.removeFirst(count / 2);
+    QCOMPARE(pyramid.count(), 0);
+    QCOMPARE(pyramid.levelCount(), 0);
+}
+
+void tst_XYMinMaxPyramid::append()
+{
+    // Appending in parts gives the same summary as appending all points at once
+    const int count = 30000;
+    const QVector<QPointF> points = createPoints(count, false, 3);
+    XYMinMaxPyramid pyramid;
+    for (int start = 0; start < count; start += 777)
+        pyramid.append(points.constData() + start, qMin(777, count - start));
+    QCOMPARE(pyramid.count(), count);
+
+    XYMinMaxPyramid whole;
+    whole.append(points.constData(), points.size());
+    QCOMPARE(pyramid.levelCount(), whole.levelCount());
+
+    const QVector<qreal> edges = createEdges(0, count, 250);
+    QCOMPARE(pyramid.minMax(0, count, edges), whole.minMax(0, count, edges));
+    QCOMPARE(decimate(pyramid, points, 0, count, edges),
+             XYDecimator::minMax(points, 0, count, edges));
+}
+
+QTEST_MAIN(tst_XYMinMaxPyramid)
+#include "tst_xyminmaxpyramid.moc"
@@ -0,0 +1,155 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChartView>
+#include <QtCharts/QValueAxis>
+#include <QtCharts/QLogValueAxis>
+#include <QtCharts/QDateTimeAxis>
+#include <QtCharts/QCategoryAxis>
+#include <QtCharts/QBarCategoryAxis>
+#include <QtCore/QDateTime>
+
+QT_CHARTS_USE_NAMESPACE
+
+Q_DECLARE_METATYPE(QAbstractAxis::AxisType)
+
+// Benchmarks the label generation and layout of each axis type.
+// Run with -platform offscreen to run them without a display.
+class tst_bench_Axes : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void setRange_data();
+    void setRange();
+};
+
+void tst_bench_Axes::setRange_data()
+{
+    QTest::addColumn<QAbstractAxis::AxisType>("type");
+    QTest::addColumn<int>("tickCount");
+
+    QTest::newRow("value") << QAbstractAxis::AxisTypeValue << 5;
+    QTest::newRow("value-50-ticks") << QAbstractAxis::AxisTypeValue << 50;
+    QTest::newRow("logvalue") << QAbstractAxis::AxisTypeLogValue << 0;
+    QTest::newRow("datetime") << QAbstractAxis::AxisTypeDateTime << 5;
+    QTest::newRow("datetime-50-ticks") << QAbstractAxis::AxisTypeDateTime << 50;
+    QTest::newRow("category") << QAbstractAxis::AxisTypeCategory << 50;
+    QTest::newRow("barcategory") << QAbstractAxis::AxisTypeBarCategory << 50;
+}
+
+// Measures a frame of changing the range of a horizontal axis, which generates its labels
+// and lays out the chart again
+void tst_bench_Axes::setRange()
+{
+    QFETCH(QAbstractAxis::AxisType, type);
+    QFETCH(int, tickCount);
+
+    QAbstractAxis *axis = nullptr;
+    QVariant ranges[2][2];
+    switch (type) {
+    case QAbstractAxis::AxisTypeLogValue: {
+        QLogValueAxis *logAxis = new QLogValueAxis();
+        logAxis->setLabelFormat(QStringLiteral("%g"));
+        axis = logAxis;
+        ranges[0][0] = 1.0;
+        ranges[0][1] = 1e10;
+        ranges[1][0] = 10.0;
+        ranges[1][1] = 1e12;
+        break;
+    }
+    case QAbstractAxis::AxisTypeDateTime: {
+        QDateTimeAxis *dateTimeAxis = new QDateTimeAxis();
+        dateTimeAxis->setTickCount(tickCount);
+        dateTimeAxis->setFormat(QStringLiteral("dd.MM.yyyy hh:mm:ss"));
+        axis = dateTimeAxis;
+        const QDateTime start(QDate(2020, 1, 1), QTime(0, 0));
+        ranges[0][0] = start;
+        ranges[0][1] = start.addDays(1);
+        ranges[1][0] = start.addSecs(3600);
+        ranges[1][1] = start.addDays(2);
+        break;
+    }
+    case QAbstractAxis::AxisTypeCategory: {
+        QCategoryAxis *categoryAxis = new QCategoryAxis();
+        for (int i = 1; i <= tickCount; i++)
+            categoryAxis->append(QStringLiteral("Category %1").arg(i), i * 10);
+        axis = categoryAxis;
+        ranges[0][0] = 0.0;
+        ranges[0][1] = tickCount * 10.0;
+        ranges[1][0] = 5.0;
+        ranges[1][1] = tickCount * 5.0;
+        break;
+    }
+    case QAbstractAxis::AxisTypeBarCategory: {
+        QBarCategoryAxis *barCategoryAxis = new QBarCategoryAxis();
+        QStringList categories;
+        for (int i = 1; i <= tickCount; i++)
+            categories.append(QStringLiteral("Category %1").arg(i));
+        barCategoryAxis->append(categories);
+        axis = barCategoryAxis;
+        ranges[0][0] = categories.first();
+        ranges[0][1] = categories.last();
+        ranges[1][0] = categories.at(1);
+        ranges[1][1] = categories.at(tickCount / 2);
+        break;
+    }
+    default: {
+        QValueAxis *valueAxis = new QValueAxis();
+        valueAxis->setTickCount(tickCount);
+        valueAxis->setLabelFormat(QStringLiteral("%.3f"));
+        axis = valueAxis;
+        ranges[0][0] = 0.0;
+        ranges[0][1] = 100.0;
+        ranges[1][0] = 1.5;
+        ranges[1][1] = 1000.25;
+        break;
+    }
+    }
+
+    QChartView view;
+    view.resize(1024, 600);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addAxis(axis, Qt::AlignBottom);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int index = 0;
+    QBENCHMARK {
+        index = 1 - index;
+        axis->setRange(ranges[index][0], ranges[index][1]);
+        QCoreApplication::processEvents();
+        view.repaint();
+    }
+}
+
+QTEST_MAIN(tst_bench_Axes)
+
+#include "tst_bench_axes.moc"
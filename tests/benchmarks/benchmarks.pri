@@ -0,0 +1,8 @@
+!include( ../tests.pri ) {
+    error( "Couldn't find the tests.pri file!" )
+}
+
+CONFIG += benchmark
+QT += testlib widgets
+
+!contains(TARGET, ^tst_.*):TARGET = $$join(TARGET,,"tst_bench_")
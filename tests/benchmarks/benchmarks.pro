@@ -0,0 +1,8 @@
+TEMPLATE = subdirs
+SUBDIRS += \
+           axes \
+           domain \
+           openglseries \
+           qlineseries \
+           qxymodelmapper \
+           xyseries
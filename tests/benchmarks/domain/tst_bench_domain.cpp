@@ -0,0 +1,191 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <private/xydomain_p.h>
+#include <private/xlogydomain_p.h>
+#include <private/logxydomain_p.h>
+#include <private/logxlogydomain_p.h>
+#include <private/xypolardomain_p.h>
+#include <private/xlogypolardomain_p.h>
+#include <private/logxypolardomain_p.h>
+#include <private/logxlogypolardomain_p.h>
+#include <QtCore/QtMath>
+
+QT_CHARTS_USE_NAMESPACE
+
+Q_DECLARE_METATYPE(AbstractDomain::DomainType)
+
+class tst_bench_Domain : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void calculateGeometryPoints_data();
+    void calculateGeometryPoints();
+    void calculateGeometryPoint_data();
+    void calculateGeometryPoint();
+
+private:
+    AbstractDomain *createDomain(AbstractDomain::DomainType type);
+};
+
+AbstractDomain *tst_bench_Domain::createDomain(AbstractDomain::DomainType type)
+{
+    AbstractDomain *domain = nullptr;
+    switch (type) {
+    case AbstractDomain::XYDomain:
+        domain = new XYDomain(this);
+        break;
+    case AbstractDomain::XLogYDomain:
+        domain = new XLogYDomain(this);
+        break;
+    case AbstractDomain::LogXYDomain:
+        domain = new LogXYDomain(this);
+        break;
+    case AbstractDomain::LogXLogYDomain:
+        domain = new LogXLogYDomain(this);
+        break;
+    case AbstractDomain::XYPolarDomain:
+        domain = new XYPolarDomain(this);
+        break;
+    case AbstractDomain::XLogYPolarDomain:
+        domain = new XLogYPolarDomain(this);
+        break;
+    case AbstractDomain::LogXYPolarDomain:
+        domain = new LogXYPolarDomain(this);
+        break;
+    case AbstractDomain::LogXLogYPolarDomain:
+        domain = new LogXLogYPolarDomain(this);
+        break;
+    default:
+        return nullptr;
+    }
+    // Polar domains require a square size
+    domain->setSize(QSizeF(800, 800));
+    domain->setRange(1, 1000, 1, 1000);
+    return domain;
+}
+
+static void addRows()
+{
+    QTest::addColumn<AbstractDomain::DomainType>("type");
+    QTest::addColumn<int>("count");
+
+    const QList<QPair<AbstractDomain::DomainType, QByteArray> > types = {
+        { AbstractDomain::XYDomain, "XY" },
+        { AbstractDomain::XLogYDomain, "XLogY" },
+        { AbstractDomain::LogXYDomain, "LogXY" },
+        { AbstractDomain::LogXLogYDomain, "LogXLogY" },
+        { AbstractDomain::XYPolarDomain, "XYPolar" },
+        { AbstractDomain::XLogYPolarDomain, "XLogYPolar" },
+        { AbstractDomain::LogXYPolarDomain, "LogXYPolar" },
+        { AbstractDomain::LogXLogYPolarDomain, "LogXLogYPolar" }
+    };
+    const QList<QPair<int, QByteArray> > counts = {
+        { 10000, "10k" },
+        { 100000, "100k" },
+        { 1000000, "1M" },
+        { 10000000, "10M" }
+    };
+    for (const auto &type : types) {
+        for (const auto &count : counts) {
+            QTest::newRow((type.second + ' ' + count.second).constData())
+                    << type.first << count.first;
+        }
+    }
+}
+
+static QVector<QPointF> createPoints(int count)
+{
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++) {
+        const qreal x = 1 + 999.0 * i / count;
+        points.append(QPointF(x, 500.5 + 499 * qSin(x)));
+    }
+    return points;
+}
+
+void tst_bench_Domain::calculateGeometryPoints_data()
+{
+    addRows();
+}
+
+// Batched transform, as used on every pan, zoom and resize
+void tst_bench_Domain::calculateGeometryPoints()
+{
+    QFETCH(AbstractDomain::DomainType, type);
+    QFETCH(int, count);
+
+    AbstractDomain *domain = createDomain(type);
+    const QVector<QPointF> points = createPoints(count);
+
+    QVector<QPointF> result;
+    QBENCHMARK {
+        result = domain->calculateGeometryPoints(points);
+    }
+    QCOMPARE(result.size(), count);
+    delete domain;
+}
+
+void tst_bench_Domain::calculateGeometryPoint_data()
+{
+    addRows();
+}
+
+// Reference: transforming the same points one at a time
+void tst_bench_Domain::calculateGeometryPoint()
+{
+    QFETCH(AbstractDomain::DomainType, type);
+    QFETCH(int, count);
+
+    AbstractDomain *domain = createDomain(type);
+    const QVector<QPointF> points = createPoints(count);
+
+    QVector<QPointF> result(count);
+    QBENCHMARK {
+        bool ok;
+        for (int i = 0; i < count; i++)
+            result[i] = domain->calculateGeometryPoint(points.at(i), ok);
+    }
+
+    // The batched and the scalar transforms must agree
+    const QVector<QPointF> batched = domain->calculateGeometryPoints(points);
+    QCOMPARE(batched.size(), count);
+    for (int i = 0; i < count; i += qMax(1, count / 1000)) {
+        QVERIFY(qAbs(batched.at(i).x() - result.at(i).x()) < 1e-6);
+        QVERIFY(qAbs(batched.at(i).y() - result.at(i).y()) < 1e-6);
+    }
+    delete domain;
+}
+
+QTEST_MAIN(tst_bench_Domain)
+
+#include "tst_bench_domain.moc"
@@ -0,0 +1,154 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+#include <QtTest/QtTest>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <QtGui/QOpenGLContext>
+#include <QtCore/QtMath>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Benchmarks a line series drawn with OpenGL, where the points are uploaded to a vertex buffer.
+// Run with -platform offscreen; the OpenGL rows are skipped when no context can be created.
+// With Mesa, LIBGL_ALWAYS_SOFTWARE=1 uses llvmpipe when there is no GPU.
+class tst_bench_OpenGLSeries : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void append_data();
+    void append();
+    void pan_data();
+    void pan();
+
+private:
+    void addCountData();
+    QLineSeries *addSeries(QChartView *view, int count);
+};
+
+static QVector<QPointF> createPoints(int start, int count)
+{
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = start; i < start + count; i++)
+        points.append(QPointF(i, qSin(i / 100.0)));
+    return points;
+}
+
+void tst_bench_OpenGLSeries::initTestCase()
+{
+    QOpenGLContext context;
+    if (!context.create())
+        QSKIP("Cannot create an OpenGL context");
+}
+
+void tst_bench_OpenGLSeries::addCountData()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+    QTest::newRow("10M") << 10000000;
+}
+
+QLineSeries *tst_bench_OpenGLSeries::addSeries(QChartView *view, int count)
+{
+    QLineSeries *series = new QLineSeries;
+    series->setUseOpenGL(true);
+    series->replace(createPoints(0, count));
+    view->chart()->addSeries(series);
+    view->chart()->createDefaultAxes();
+    view->resize(800, 600);
+    return series;
+}
+
+void tst_bench_OpenGLSeries::append_data()
+{
+    addCountData();
+}
+
+// Measures appending 100k points one by one into a series that already has the row's point
+// count, with a frame drawn after every thousand appends. Only the appended range of the
+// vertex buffer needs to be uploaded for each frame.
+void tst_bench_OpenGLSeries::append()
+{
+    QFETCH(int, count);
+
+    QChartView view;
+    QLineSeries *series = addSeries(&view, count);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    const int appendCount = 100000;
+    const int frameInterval = 1000;
+    const QVector<QPointF> points = createPoints(count, appendCount);
+    QBENCHMARK_ONCE {
+        for (int i = 0; i < appendCount; i++) {
+            series->append(points.at(i));
+            if ((i + 1) % frameInterval == 0) {
+                QCoreApplication::processEvents();
+                view.repaint();
+            }
+        }
+    }
+    QCOMPARE(series->count(), count + appendCount);
+}
+
+void tst_bench_OpenGLSeries::pan_data()
+{
+    addCountData();
+}
+
+// Measures a frame of panning over the series, which only updates the transformation of the
+// points and does not upload them again
+void tst_bench_OpenGLSeries::pan()
+{
+    QFETCH(int, count);
+
+    QChartView view;
+    addSeries(&view, count);
+    QValueAxis *axis = qobject_cast<QValueAxis *>(view.chart()->axes(Qt::Horizontal).first());
+    QVERIFY(axis);
+    const int visibleCount = count / 10;
+    axis->setRange(0, visibleCount);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int start = 0;
+    QBENCHMARK {
+        start = (start + visibleCount / 10) % (count - visibleCount);
+        axis->setRange(start, start + visibleCount);
+        view.repaint();
+    }
+}
+
+QTEST_MAIN(tst_bench_OpenGLSeries)
+
+#include "tst_bench_openglseries.moc"
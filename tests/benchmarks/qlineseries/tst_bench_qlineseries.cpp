@@ -0,0 +1,220 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <QtCore/QtMath>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_bench_QLineSeries : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void append_data();
+    void append();
+    void pan_data();
+    void pan();
+    void zoom_data();
+    void zoom();
+    void replace_data();
+    void replace();
+};
+
+void tst_bench_QLineSeries::append_data()
+{
+    QTest::addColumn<int>("initialCount");
+
+    QTest::newRow("1k") << 1000;
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+}
+
+// Measures appending a batch of points to a visible series. The cost per batch should not
+// depend on the number of points already in the series.
+void tst_bench_QLineSeries::append()
+{
+    QFETCH(int, initialCount);
+
+    QVector<QPointF> points;
+    points.reserve(initialCount);
+    for (int i = 0; i < initialCount; i++)
+        points.append(QPointF(i, qSin(i / 100.0)));
+
+    QLineSeries *series = new QLineSeries();
+    series->replace(points);
+
+    QChartView view;
+    view.resize(800, 600);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    // Leave room for the points appended over all benchmark iterations, so that the domain
+    // does not change and every point stays visible
+    view.chart()->axes(Qt::Horizontal).first()->setRange(0, initialCount + 1000000);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int x = initialCount;
+    QBENCHMARK {
+        for (int i = 0; i < 100; i++, x++)
+            series->append(x, qSin(x / 100.0));
+    }
+}
+
+void tst_bench_QLineSeries::pan_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+    QTest::newRow("10M") << 10000000;
+}
+
+// Measures panning a view that shows 1% of a series with ascending x values. Only the
+// visible points are mapped to geometry, so the cost should not depend on the series size.
+void tst_bench_QLineSeries::pan()
+{
+    QFETCH(int, count);
+
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++)
+        points.append(QPointF(i, qSin(i / 100.0)));
+
+    QLineSeries *series = new QLineSeries();
+    series->replace(points);
+
+    QChartView view;
+    view.resize(800, 600);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(view.chart()->axes(Qt::Horizontal).first());
+    const int visibleCount = count / 100;
+    axisX->setRange(0, visibleCount);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int start = 0;
+    QBENCHMARK {
+        start = (start + visibleCount / 10) % (count - visibleCount);
+        axisX->setRange(start, start + visibleCount);
+        view.repaint();
+    }
+}
+
+void tst_bench_QLineSeries::zoom_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+    QTest::newRow("10M") << 10000000;
+}
+
+// Measures zooming between the whole series and a tenth of it with min/max decimation.
+// The decimation is taken from the min/max summary of the series, so the cost should
+// depend on the width of the plot area rather than on the series size.
+void tst_bench_QLineSeries::zoom()
+{
+    QFETCH(int, count);
+
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++)
+        points.append(QPointF(i, qSin(i / 100.0)));
+
+    QLineSeries *series = new QLineSeries();
+    series->setDecimationMode(QLineSeries::MinMaxDecimation);
+    series->replace(points);
+
+    QChartView view;
+    view.resize(800, 600);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(view.chart()->axes(Qt::Horizontal).first());
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    bool zoomedOut = false;
+    QBENCHMARK {
+        zoomedOut = !zoomedOut;
+        axisX->setRange(0, zoomedOut ? count : count / 10);
+        view.repaint();
+    }
+}
+
+void tst_bench_QLineSeries::replace_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+}
+
+// Measures replacing all the points of a fully visible series, which rebuilds the whole line
+// geometry. The stroked shape is only needed for hit testing and is not part of the update.
+void tst_bench_QLineSeries::replace()
+{
+    QFETCH(int, count);
+
+    QVector<QPointF> points[2];
+    for (int j = 0; j < 2; j++) {
+        points[j].reserve(count);
+        for (int i = 0; i < count; i++)
+            points[j].append(QPointF(i, qSin((i + j * 50) / 100.0)));
+    }
+
+    QLineSeries *series = new QLineSeries();
+    series->replace(points[0]);
+
+    QChartView view;
+    view.resize(800, 600);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int j = 0;
+    QBENCHMARK {
+        j = 1 - j;
+        series->replace(points[j]);
+    }
+}
+
+QTEST_MAIN(tst_bench_QLineSeries)
+
+#include "tst_bench_qlineseries.moc"
@@ -0,0 +1,225 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QVXYModelMapper>
+#include <QtCore/QAbstractTableModel>
+#include <QtGui/QStandardItemModel>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Table model with the x values in the first column and the y values in the second one
+class PointModel : public QAbstractTableModel
+{
+public:
+    PointModel(int count)
+        : m_points(count)
+    {
+        for (int i = 0; i < count; i++)
+            m_points[i] = QPointF(i, i % 100);
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const
+    {
+        return parent.isValid() ? 0 : int(m_points.size());
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const
+    {
+        return parent.isValid() ? 0 : 2;
+    }
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const
+    {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        const QPointF &point = m_points.at(index.row());
+        return index.column() == 0 ? point.x() : point.y();
+    }
+
+    // Changes all y values and reports it with a single dataChanged()
+    void shiftValues(qreal dy)
+    {
+        for (QPointF &point : m_points)
+            point.ry() += dy;
+        emit dataChanged(index(0, 1), index(int(m_points.size()) - 1, 1));
+    }
+
+    void insertPoints(int row, int count)
+    {
+        beginInsertRows(QModelIndex(), row, row + count - 1);
+        m_points.insert(row, count, QPointF());
+        endInsertRows();
+    }
+
+    void removePoints(int row, int count)
+    {
+        beginRemoveRows(QModelIndex(), row, row + count - 1);
+        m_points.remove(row, count);
+        endRemoveRows();
+    }
+
+private:
+    QVector<QPointF> m_points;
+};
+
+class tst_bench_QXYModelMapper : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initialize_data();
+    void initialize();
+    void initializeStandardItemModel_data();
+    void initializeStandardItemModel();
+    void dataChanged_data();
+    void dataChanged();
+    void rowsInsertedAndRemoved_data();
+    void rowsInsertedAndRemoved();
+};
+
+void tst_bench_QXYModelMapper::initialize_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+}
+
+// Measures mapping a whole model to a series
+void tst_bench_QXYModelMapper::initialize()
+{
+    QFETCH(int, count);
+
+    PointModel model(count);
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setSeries(&series);
+
+    QBENCHMARK {
+        mapper.setModel(nullptr);
+        mapper.setModel(&model);
+    }
+    QCOMPARE(series.count(), count);
+}
+
+void tst_bench_QXYModelMapper::initializeStandardItemModel_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+}
+
+void tst_bench_QXYModelMapper::initializeStandardItemModel()
+{
+    QFETCH(int, count);
+
+    QStandardItemModel model(count, 2);
+    for (int i = 0; i < count; i++) {
+        model.setItem(i, 0, new QStandardItem(QString::number(i)));
+        model.setItem(i, 1, new QStandardItem(QString::number(i % 100)));
+    }
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setSeries(&series);
+
+    QBENCHMARK {
+        mapper.setModel(nullptr);
+        mapper.setModel(&model);
+    }
+    QCOMPARE(series.count(), count);
+}
+
+void tst_bench_QXYModelMapper::dataChanged_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+}
+
+// Measures a dataChanged() that covers every mapped row. The series should be updated once,
+// in time linear to the number of rows.
+void tst_bench_QXYModelMapper::dataChanged()
+{
+    QFETCH(int, count);
+
+    PointModel model(count);
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setSeries(&series);
+    mapper.setModel(&model);
+    QSignalSpy spy(&series, SIGNAL(pointsReplaced()));
+
+    QBENCHMARK {
+        model.shiftValues(1);
+    }
+    QVERIFY(spy.count() > 0);
+    QCOMPARE(series.at(count - 1), QPointF(count - 1, (count - 1) % 100 + spy.count()));
+}
+
+void tst_bench_QXYModelMapper::rowsInsertedAndRemoved_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("1M") << 1000000;
+}
+
+// Measures inserting and removing a tenth of the rows in the middle of the model
+void tst_bench_QXYModelMapper::rowsInsertedAndRemoved()
+{
+    QFETCH(int, count);
+
+    PointModel model(count);
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setSeries(&series);
+    mapper.setModel(&model);
+
+    QBENCHMARK {
+        model.insertPoints(count / 2, count / 10);
+        model.removePoints(count / 2, count / 10);
+    }
+    QCOMPARE(series.count(), count);
+}
+
+QTEST_MAIN(tst_bench_QXYModelMapper)
+
+#include "tst_bench_qxymodelmapper.moc"
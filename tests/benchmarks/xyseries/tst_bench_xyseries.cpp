@@ -0,0 +1,299 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QSplineSeries>
+#include <QtCharts/QScatterSeries>
+#include <QtCharts/QAreaSeries>
+#include <QtCharts/QValueAxis>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+#include <QtCore/QtMath>
+
+QT_CHARTS_USE_NAMESPACE
+
+Q_DECLARE_METATYPE(QAbstractSeries::SeriesType)
+
+// Benchmarks the common operations on each XY series type in a visible chart view.
+// Run with -platform offscreen to run them without a display.
+class tst_bench_XYSeries : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void append_data();
+    void append();
+    void replace_data();
+    void replace();
+    void pan_data();
+    void pan();
+    void zoom_data();
+    void zoom();
+    void resize_data();
+    void resize();
+    void render_data();
+    void render();
+
+private:
+    void addSeriesData();
+    QXYSeries *addSeries(QChartView *view, QAbstractSeries::SeriesType type,
+                         const QVector<QPointF> &points);
+    QValueAxis *axisX(QChartView *view);
+};
+
+static QVector<QPointF> createPoints(int count, int phase = 0)
+{
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++)
+        points.append(QPointF(i, qSin((i + phase) / 100.0)));
+    return points;
+}
+
+void tst_bench_XYSeries::addSeriesData()
+{
+    QTest::addColumn<QAbstractSeries::SeriesType>("type");
+    QTest::addColumn<int>("count");
+
+    const QList<QPair<QAbstractSeries::SeriesType, QByteArray> > types = {
+        { QAbstractSeries::SeriesTypeLine, "line" },
+        { QAbstractSeries::SeriesTypeSpline, "spline" },
+        { QAbstractSeries::SeriesTypeScatter, "scatter" },
+        { QAbstractSeries::SeriesTypeArea, "area" }
+    };
+    const QList<QPair<int, QByteArray> > counts = {
+        { 1000, "1k" },
+        { 100000, "100k" },
+        { 10000000, "10M" }
+    };
+    for (const auto &type : types) {
+        for (const auto &count : counts) {
+            const QByteArray name = type.second + '-' + count.second;
+            QTest::newRow(name.constData()) << type.first << count.first;
+        }
+    }
+}
+
+// Adds a series of the type with the points to the view and creates the axes. Returns the
+// series that holds the points, which is the upper series of an area series.
+QXYSeries *tst_bench_XYSeries::addSeries(QChartView *view, QAbstractSeries::SeriesType type,
+                                         const QVector<QPointF> &points)
+{
+    QXYSeries *series = nullptr;
+    QAbstractSeries *chartSeries = nullptr;
+    switch (type) {
+    case QAbstractSeries::SeriesTypeSpline:
+        series = new QSplineSeries();
+        break;
+    case QAbstractSeries::SeriesTypeScatter:
+        series = new QScatterSeries();
+        break;
+    case QAbstractSeries::SeriesTypeArea:
+        series = new QLineSeries();
+        chartSeries = new QAreaSeries(static_cast<QLineSeries *>(series));
+        break;
+    default:
+        series = new QLineSeries();
+        break;
+    }
+    series->replace(points);
+
+    view->resize(800, 600);
+    view->chart()->legend()->setVisible(false);
+    view->chart()->addSeries(chartSeries ? chartSeries : series);
+    view->chart()->createDefaultAxes();
+    return series;
+}
+
+QValueAxis *tst_bench_XYSeries::axisX(QChartView *view)
+{
+    return qobject_cast<QValueAxis *>(view->chart()->axes(Qt::Horizontal).first());
+}
+
+void tst_bench_XYSeries::append_data()
+{
+    addSeriesData();
+}
+
+// Measures appending a batch of 1000 points to a visible series whose x-range leaves room
+// for them, so that the domain does not change.
+void tst_bench_XYSeries::append()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, count);
+
+    QChartView view;
+    QXYSeries *series = addSeries(&view, type, createPoints(count));
+    axisX(&view)->setRange(0, count * 4);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int x = count;
+    QBENCHMARK {
+        QList<QPointF> points;
+        points.reserve(1000);
+        for (int i = 0; i < 1000; i++, x++)
+            points.append(QPointF(x, qSin(x / 100.0)));
+        series->append(points);
+    }
+}
+
+void tst_bench_XYSeries::replace_data()
+{
+    addSeriesData();
+}
+
+// Measures replacing all the points of a visible series
+void tst_bench_XYSeries::replace()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, count);
+
+    const QVector<QPointF> points[2] = { createPoints(count), createPoints(count, 50) };
+
+    QChartView view;
+    QXYSeries *series = addSeries(&view, type, points[0]);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int index = 0;
+    QBENCHMARK {
+        index = 1 - index;
+        series->replace(points[index]);
+    }
+}
+
+void tst_bench_XYSeries::pan_data()
+{
+    addSeriesData();
+}
+
+// Measures a frame of panning a view that shows 1% of the series
+void tst_bench_XYSeries::pan()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, count);
+
+    QChartView view;
+    addSeries(&view, type, createPoints(count));
+    QValueAxis *axis = axisX(&view);
+    const int visibleCount = qMax(count / 100, 10);
+    axis->setRange(0, visibleCount);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    int start = 0;
+    QBENCHMARK {
+        start = (start + visibleCount / 10) % (count - visibleCount);
+        axis->setRange(start, start + visibleCount);
+        view.repaint();
+    }
+}
+
+void tst_bench_XYSeries::zoom_data()
+{
+    addSeriesData();
+}
+
+// Measures a frame of zooming between the whole series and a tenth of it
+void tst_bench_XYSeries::zoom()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, count);
+
+    QChartView view;
+    addSeries(&view, type, createPoints(count));
+    QValueAxis *axis = axisX(&view);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    bool zoomedOut = false;
+    QBENCHMARK {
+        zoomedOut = !zoomedOut;
+        axis->setRange(0, zoomedOut ? count : count / 10);
+        view.repaint();
+    }
+}
+
+void tst_bench_XYSeries::resize_data()
+{
+    addSeriesData();
+}
+
+// Measures a frame of resizing the view, which lays out the chart and maps all the visible
+// points to the new plot area
+void tst_bench_XYSeries::resize()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, count);
+
+    QChartView view;
+    addSeries(&view, type, createPoints(count));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    bool larger = false;
+    QBENCHMARK {
+        larger = !larger;
+        view.resize(larger ? QSize(1024, 768) : QSize(800, 600));
+        QCoreApplication::processEvents();
+        view.repaint();
+    }
+}
+
+void tst_bench_XYSeries::render_data()
+{
+    addSeriesData();
+}
+
+// Measures rendering the chart into an image, as done when grabbing or printing a chart
+void tst_bench_XYSeries::render()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, count);
+
+    QChartView view;
+    addSeries(&view, type, createPoints(count));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QImage image(view.size(), QImage::Format_ARGB32_Premultiplied);
+    QBENCHMARK {
+        image.fill(Qt::white);
+        QPainter painter(&image);
+        painter.setRenderHint(QPainter::Antialiasing);
+        view.chart()->scene()->render(&painter);
+    }
+}
+
+QTEST_MAIN(tst_bench_XYSeries)
+
+#include "tst_bench_xyseries.moc"
@@ -1,3 +1,3 @@
 TEMPLATE = subdirs
-SUBDIRS += auto
+SUBDIRS += auto benchmarks
 exists(manual): SUBDIRS += manual